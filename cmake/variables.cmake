@@ -84,6 +84,7 @@ option(RPP_BUILD_SFML_CODE "Enable SFML support in examples/code." OFF)
 option(RPP_BUILD_QT_CODE "Enable QT support in examples/code." OFF)
 option(RPP_BUILD_GRPC_CODE "Enable grpc++ support in examples/code." OFF)
 option(RPP_BUILD_ASIO_CODE "Enable ASIO support in examples/code." OFF)
+option(RPP_ENABLE_SCHEDULERS_INSTRUMENTATION "Collect statistics of schedulers (queue depth, lag, execution time) available via rpp::schedulers::instrumentation::get_statistics." OFF)
 
 if (RPP_DEVELOPER_MODE)
   option(RPP_BUILD_TESTS      "Build unit tests tree." OFF)
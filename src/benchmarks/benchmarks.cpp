@@ -3,13 +3,18 @@
 
 #include <rpp/rpp.hpp>
 
+#include <array>
+#include <atomic>
+#include <cstdlib>
 #include <fstream>
 #include <functional>
 #include <iostream>
 #include <map>
+#include <memory_resource>
 #include <span>
 #include <string_view>
 #include <tuple>
+#include <vector>
 #ifdef RPP_BUILD_RXCPP
     #include <rxcpp/rx.hpp>
 #endif
@@ -19,6 +24,7 @@
     if (!benchmark.has_value() || std::string_view{NAME}.find(benchmark.value()) != std::string_view::npos)
 #define SECTION(NAME)                      \
     bench.context("benchmark_name", NAME); \
+    current_section = NAME;                \
     if (!section.has_value() || std::string_view{NAME}.find(section.value()) != std::string_view::npos)
 #define TEST_RPP(...) \
     if (!disable_rpp) bench.context("source", "rpp").run(__VA_ARGS__)
@@ -28,6 +34,52 @@
 #else
     #define TEST_RXCPP(...)
 #endif
+#define CHECK_RPP_ALLOCATIONS(MAX_PER_ITERATION, ...) \
+    if (!disable_rpp) check_allocations(current_section, MAX_PER_ITERATION, __VA_ARGS__)
+
+namespace
+{
+    // allocations are counted only inside of `check_allocations`, so measured sections are not affected by counting
+    std::atomic_bool   s_count_allocations{};
+    std::atomic_size_t s_allocations_count{};
+} // namespace
+
+void* operator new(std::size_t size)
+{
+    if (s_count_allocations.load(std::memory_order_relaxed))
+        s_allocations_count.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size == 0 ? 1 : size))
+        return ptr;
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+// checks amount of heap allocations per iteration in steady state (after warm-up of caches and pools) and reports unexpected ones
+template<typename Fn>
+void check_allocations(std::string_view section, size_t max_per_iteration, Fn&& fn)
+{
+    constexpr size_t iterations = 1000;
+
+    fn();
+    const auto before = s_allocations_count.load();
+    s_count_allocations.store(true);
+    for (size_t i = 0; i < iterations; ++i)
+        fn();
+    s_count_allocations.store(false);
+    const auto per_iteration = (s_allocations_count.load() - before) / iterations;
+
+    if (per_iteration > max_per_iteration)
+        std::cerr << "'" << section << "' performs " << per_iteration << " allocations per iteration, but expected at most " << max_per_iteration << std::endl;
+}
 
 char const * json() noexcept
 {
@@ -84,6 +136,8 @@ int main(int argc, char* argv[]) // NOLINT(bugprone-exception-escape)
     const auto disable_rpp   = find_argument("--disable_rpp", args).has_value();
     const auto dump          = find_argument("--dump=", args);
 
+    std::string_view current_section{};
+
     BENCHMARK("General")
     {
         SECTION("Subscribe empty callbacks to empty observable")
@@ -119,6 +173,29 @@ int main(int argc, char* argv[]) // NOLINT(bugprone-exception-escape)
                     | rxcpp::operators::subscribe<int>([](int) {});
             });
         }
+
+        SECTION("Subscribe empty callbacks to dynamic observable")
+        {
+            const auto test = [&]() {
+                rpp::source::create<int>([&](auto&& observer) {
+                    ankerl::nanobench::doNotOptimizeAway(observer);
+                })
+                    .as_dynamic()
+                    .subscribe([](int) {});
+            };
+
+            TEST_RPP(test);
+            // both observable and observer are placed inline
+            CHECK_RPP_ALLOCATIONS(0, test);
+
+            TEST_RXCPP([&]() {
+                rxcpp::observable<>::create<int>([&](auto&& observer) {
+                    ankerl::nanobench::doNotOptimizeAway(observer);
+                })
+                    .as_dynamic()
+                    .subscribe([](int) {});
+            });
+        }
     }; // BENCHMARK("General")
 
     BENCHMARK("Sources")
@@ -252,21 +329,23 @@ int main(int argc, char* argv[]) // NOLINT(bugprone-exception-escape)
 
         SECTION("current_thread scheduler create worker + schedule + recursive schedule")
         {
-            TEST_RPP(
-                [&]() {
-                    const auto worker = rpp::schedulers::current_thread::create_worker();
-                    worker.schedule(
-                        [&worker](auto&& v) {
-                            worker.schedule(
-                                [](const auto& v) {
-                                    ankerl::nanobench::doNotOptimizeAway(v);
-                                    return rpp::schedulers::optional_delay_from_now{};
-                                },
-                                std::move(v));
-                            return rpp::schedulers::optional_delay_from_now{};
-                        },
-                        rpp::make_lambda_observer([](int) {}));
-                });
+            const auto test = [&]() {
+                const auto worker = rpp::schedulers::current_thread::create_worker();
+                worker.schedule(
+                    [&worker](auto&& v) {
+                        worker.schedule(
+                            [](const auto& v) {
+                                ankerl::nanobench::doNotOptimizeAway(v);
+                                return rpp::schedulers::optional_delay_from_now{};
+                            },
+                            std::move(v));
+                        return rpp::schedulers::optional_delay_from_now{};
+                    },
+                    rpp::make_lambda_observer([](int) {}));
+            };
+
+            TEST_RPP(test);
+            CHECK_RPP_ALLOCATIONS(0, test);
             TEST_RXCPP(
                 [&]() {
                     const auto worker = rxcpp::identity_current_thread()
@@ -278,6 +357,108 @@ int main(int argc, char* argv[]) // NOLINT(bugprone-exception-escape)
                     });
                 });
         }
+
+        SECTION("current_thread scheduler create worker + schedule + 100 recursive schedules")
+        {
+            TEST_RPP([&]() {
+                const auto worker = rpp::schedulers::current_thread::create_worker();
+                worker.schedule(
+                    [&worker](const auto& v) {
+                        for (size_t i = 0; i < 100; ++i)
+                        {
+                            worker.schedule(
+                                [](const auto& v) {
+                                    ankerl::nanobench::doNotOptimizeAway(v);
+                                    return rpp::schedulers::optional_delay_from_now{};
+                                },
+                                v);
+                        }
+                        return rpp::schedulers::optional_delay_from_now{};
+                    },
+                    rpp::make_lambda_observer([](int) {}).as_dynamic());
+            });
+            TEST_RXCPP([&]() {
+                const auto worker = rxcpp::identity_current_thread()
+                                        .create_coordinator()
+                                        .get_worker();
+
+                worker.schedule([&worker](const auto&) {
+                    for (size_t i = 0; i < 100; ++i)
+                        worker.schedule([](const auto& v) { ankerl::nanobench::doNotOptimizeAway(v); });
+                });
+            });
+        }
+
+        SECTION("run_loop scheduler schedule + dispatch")
+        {
+            {
+                const rpp::schedulers::run_loop run_loop{};
+                const auto                      worker = run_loop.create_worker();
+                const auto                      test   = [&]() {
+                    worker.schedule([](const auto& v) { ankerl::nanobench::doNotOptimizeAway(v); return rpp::schedulers::optional_delay_from_now{}; }, rpp::make_lambda_observer([](int) {}));
+                    run_loop.dispatch();
+                };
+
+                TEST_RPP(test);
+                CHECK_RPP_ALLOCATIONS(0, test);
+            }
+#ifdef RPP_BUILD_RXCPP
+            {
+                rxcpp::schedulers::run_loop run_loop{};
+                const auto                  worker = run_loop.get_scheduler().create_worker();
+                TEST_RXCPP([&]() {
+                    worker.schedule([](const auto& v) { ankerl::nanobench::doNotOptimizeAway(v); });
+                    run_loop.dispatch();
+                });
+            }
+#endif
+        }
+
+        // median shows average oversleeping, medianAbsolutePercentError shows jitter of emissions
+        SECTION("current_thread scheduler schedule with 100us delay")
+        {
+            const auto test = [&]() {
+                rpp::schedulers::current_thread::create_worker().schedule(std::chrono::microseconds{100}, [](const auto& v) { ankerl::nanobench::doNotOptimizeAway(v); return rpp::schedulers::optional_delay_from_now{}; }, rpp::make_lambda_observer([](int) {}));
+            };
+
+            TEST_RPP(test);
+        }
+
+        SECTION("current_thread scheduler schedule with 100us delay + precise sleep")
+        {
+            const rpp::schedulers::sleep_precision_scope scope{rpp::schedulers::sleep_precision{.spin_threshold = std::chrono::microseconds{100}}};
+            const auto                                   test = [&]() {
+                rpp::schedulers::current_thread::create_worker().schedule(std::chrono::microseconds{100}, [](const auto& v) { ankerl::nanobench::doNotOptimizeAway(v); return rpp::schedulers::optional_delay_from_now{}; }, rpp::make_lambda_observer([](int) {}));
+            };
+
+            TEST_RPP(test);
+        }
+
+        SECTION("new_thread scheduler schedule with 100us delay + wait")
+        {
+            const auto worker = rpp::schedulers::new_thread::create_worker();
+            const auto test   = [&]() {
+                std::atomic_bool done{};
+                worker.schedule(std::chrono::microseconds{100}, [&done](const auto&) { done.store(true); return rpp::schedulers::optional_delay_from_now{}; }, rpp::make_lambda_observer([](int) {}));
+                while (!done.load())
+                    std::this_thread::yield();
+            };
+
+            TEST_RPP(test);
+        }
+
+        SECTION("new_thread scheduler schedule with 100us delay + wait + precise sleep")
+        {
+            const auto worker = rpp::schedulers::new_thread::create_worker(rpp::schedulers::new_thread::options{.precision = {.spin_threshold = std::chrono::microseconds{100}}});
+            const auto test   = [&]() {
+                std::atomic_bool done{};
+                worker.schedule(std::chrono::microseconds{100}, [&done](const auto&) { done.store(true); return rpp::schedulers::optional_delay_from_now{}; }, rpp::make_lambda_observer([](int) {}));
+                while (!done.load())
+                    std::this_thread::yield();
+            };
+
+            TEST_RPP(test);
+        }
     } // BENCHMARK("Schedulers")
 
     BENCHMARK("Combining Operators")
@@ -301,6 +482,32 @@ int main(int argc, char* argv[]) // NOLINT(bugprone-exception-escape)
             });
         }
 
+        SECTION("immediate_just(immediate_just(1), immediate_just(1)) + merge() + subscribe + use_arena")
+        {
+            TEST_RPP([&]() {
+                const rpp::memory_model::use_arena arena{};
+                auto                               inner_source = rpp::immediate_just(1);
+
+                rpp::immediate_just(inner_source, inner_source)
+                    | rpp::operators::merge()
+                    | rpp::operators::subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+            });
+        }
+
+        SECTION("from_iterable(1000 subjects) + merge() + subscribe + complete inner in order")
+        {
+            TEST_RPP([&]() {
+                std::vector<rpp::subjects::publish_subject<int>> subjects(1000);
+
+                rpp::source::from_iterable(subjects)
+                    | rpp::operators::flat_map([](const rpp::subjects::publish_subject<int>& subject) { return subject.get_observable(); })
+                    | rpp::operators::subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+
+                for (const auto& subject : subjects)
+                    subject.get_observer().on_completed();
+            });
+        }
+
         SECTION("immediate_just(1) + merge_with(immediate_just(2)) + subscribe")
         {
             TEST_RPP([&]() {
@@ -362,6 +569,19 @@ int main(int argc, char* argv[]) // NOLINT(bugprone-exception-escape)
                     | rxcpp::operators::subscribe<std::tuple<int, int>>([](auto&& v) { ankerl::nanobench::doNotOptimizeAway(v); });
             });
         }
+
+        SECTION("immediate_just(1) + zip(immediate_just(2)) + subscribe + monotonic memory resource")
+        {
+            TEST_RPP([&]() {
+                std::array<std::byte, 4096>                  buffer{};
+                std::pmr::monotonic_buffer_resource          resource{buffer.data(), buffer.size()};
+                const rpp::memory_model::use_memory_resource scope{&resource};
+
+                rpp::immediate_just(1)
+                    | rpp::operators::zip(rpp::immediate_just(2))
+                    | rpp::operators::subscribe([](auto&& v) { ankerl::nanobench::doNotOptimizeAway(v); });
+            });
+        }
     } // BENCHMARK("Combining Operators")
 
     BENCHMARK("Conditional Operators")
@@ -675,6 +895,27 @@ int main(int argc, char* argv[]) // NOLINT(bugprone-exception-escape)
         }
     } // BENCHMARK("Error Handling Operators")
 
+    BENCHMARK("Disposables")
+    {
+        SECTION("composite_disposable_wrapper make + as_weak + dispose")
+        {
+            TEST_RPP([&]() {
+                const auto d    = rpp::composite_disposable_wrapper::make();
+                const auto weak = d.as_weak();
+                weak.dispose();
+                ankerl::nanobench::doNotOptimizeAway(d.is_disposed());
+            });
+        }
+        SECTION("weak composite_disposable_wrapper - is_disposed")
+        {
+            const auto d    = rpp::composite_disposable_wrapper::make();
+            const auto weak = d.as_weak();
+            TEST_RPP([&]() {
+                ankerl::nanobench::doNotOptimizeAway(weak.is_disposed());
+            });
+        }
+    } // BENCHMARK("Disposables")
+
     BENCHMARK("Subjects")
     {
         SECTION("publish_subject with 1 observer - on_next")
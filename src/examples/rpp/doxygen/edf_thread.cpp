@@ -0,0 +1,52 @@
+#include <rpp/rpp.hpp>
+
+#include <iostream>
+
+/**
+ * @example edf_thread.cpp
+ **/
+
+int main() // NOLINT(bugprone-exception-escape)
+{
+    //! [edf_thread]
+    const auto scheduler = rpp::schedulers::edf_thread{rpp::schedulers::edf_thread::options{
+        .policy           = rpp::schedulers::edf_thread::miss_policy::drop,
+        .on_deadline_miss = [](const auto& miss) { std::cout << "dropped stale sample, late by " << std::chrono::duration_cast<std::chrono::milliseconds>(miss.now - miss.deadline).count() << "ms" << std::endl; }}};
+
+    // samples of this worker are worthless in 5ms after arrival
+    const auto telemetry = scheduler.create_worker(std::chrono::milliseconds{5});
+    // commands have to be executed, but not in any hurry
+    const auto commands = scheduler.create_worker(std::chrono::seconds{1});
+
+    const auto commands_obs = rpp::make_lambda_observer([](int) {}).as_dynamic();
+    commands.schedule([](const auto&) {
+        std::cout << "slow command" << std::endl;
+        std::this_thread::sleep_for(std::chrono::milliseconds{20});
+        return rpp::schedulers::optional_delay_from_now{};
+    },
+                      commands_obs);
+    // samples arrive while thread is busy with command
+    std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    for (int i = 0; i < 3; ++i)
+    {
+        // dropped sample ends its stream via on_error
+        const auto sample_obs = rpp::make_lambda_observer([](int) {}, [i](const std::exception_ptr&) { std::cout << "sample " << i << " is not processed" << std::endl; }).as_dynamic();
+        telemetry.schedule([i](const auto&) {
+            std::cout << "sample " << i << std::endl;
+            return rpp::schedulers::optional_delay_from_now{};
+        },
+                           sample_obs);
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds{100});
+
+    // Output:
+    // slow command
+    // dropped stale sample, late by 14ms
+    // sample 0 is not processed
+    // dropped stale sample, late by 14ms
+    // sample 1 is not processed
+    // dropped stale sample, late by 14ms
+    // sample 2 is not processed
+    //! [edf_thread]
+    return 0;
+}
@@ -25,5 +25,26 @@ int main()
     // [TH2]: 1
     // TH1
     //! [subscribe_on]
+
+    //! [io]
+    const rpp::schedulers::io io{};
+    for (int i = 0; i < 3; ++i)
+    {
+        rpp::source::create<int>([i](const auto& sub) {
+            // some blocking call like reading of file or socket
+            std::this_thread::sleep_for(std::chrono::milliseconds{10});
+            sub.on_next(i);
+            sub.on_completed();
+        })
+            | rpp::operators::subscribe_on(io)
+            | rpp::operators::as_blocking()
+            | rpp::operators::subscribe([](int v) { std::cout << "[" << std::this_thread::get_id() << "] : " << v << "\n"; });
+    }
+
+    // Template for output (thread released by previous subscription is reused instead of creation of new one):
+    // [TH2]: 0
+    // [TH2]: 1
+    // [TH2]: 2
+    //! [io]
     return 0;
 }
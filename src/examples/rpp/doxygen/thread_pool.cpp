@@ -27,6 +27,53 @@ int main() // NOLINT(bugprone-exception-escape)
     // [thread_4] 8
     //! [thread_pool]
 
+    //! [work_stealing]
+    const auto work_stealing_scheduler = rpp::schedulers::thread_pool{4, rpp::schedulers::thread_pool::mode::work_stealing};
+    rpp::source::just(1, 2, 3, 4, 5, 6, 7, 8)
+        | rpp::operators::flat_map([work_stealing_scheduler](int value) { return rpp::source::just(work_stealing_scheduler, value)
+                                                                               | rpp::operators::delay(std::chrono::nanoseconds{500}, rpp::schedulers::immediate{}); })
+        | rpp::operators::as_blocking()
+        | rpp::operators::subscribe([](int v) { std::cout << "[" << std::this_thread::get_id() << "] " << v << std::endl; });
+
+    // Output: (can be in any order and any thread, but each inner observable is processed serially)
+    // [thread_1] 1
+    // [thread_2] 2
+    // [thread_1] 3
+    // [thread_3] 4
+    // [thread_4] 5
+    // [thread_2] 6
+    // [thread_3] 7
+    // [thread_1] 8
+    //! [work_stealing]
+
+    //! [thread_pool_options]
+    rpp::schedulers::thread_pool::options options{};
+    options.threads_count      = 4;
+    options.numa_aware         = true; // threads are distributed between NUMA nodes and bound to cpus of own node
+    options.thread_name_prefix = "rpp_pool_";
+
+    const auto placed_scheduler = rpp::schedulers::thread_pool{options};
+    rpp::source::just(placed_scheduler, 1, 2, 3)
+        | rpp::operators::as_blocking()
+        | rpp::operators::subscribe([](int v) { std::cout << "[" << std::this_thread::get_id() << "] " << v << std::endl; });
+    //! [thread_pool_options]
+
+    //! [strand]
+    const auto strand = rpp::schedulers::strand{4};
+    rpp::source::just(1, 2, 3, 4, 5, 6, 7, 8)
+        | rpp::operators::flat_map([strand](int value) { return rpp::source::just(strand, value, value * 10)
+                                                              | rpp::operators::delay(std::chrono::nanoseconds{500}, rpp::schedulers::immediate{}); })
+        | rpp::operators::as_blocking()
+        | rpp::operators::subscribe([](int v) { std::cout << "[" << std::this_thread::get_id() << "] " << v << std::endl; });
+
+    // Output: (any value can be emitted from any thread, but each inner observable is processed serially: "value" always before "value * 10")
+    // [thread_1] 1
+    // [thread_2] 2
+    // [thread_3] 10
+    // [thread_1] 20
+    // ...
+    //! [strand]
+
     //! [computational]
     rpp::source::just(1, 2, 3, 4, 5, 6, 7, 8)
         | rpp::operators::flat_map([](int value) { return rpp::source::just(rpp::schedulers::computational{}, value)
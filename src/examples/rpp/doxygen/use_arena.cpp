@@ -0,0 +1,32 @@
+#include <rpp/rpp.hpp>
+
+#include <iostream>
+
+/**
+ * @example use_arena.cpp
+ **/
+
+int main() // NOLINT(bugprone-exception-escape)
+{
+    //! [use_arena]
+    rpp::subjects::publish_subject<int> requests{};
+    rpp::subjects::publish_subject<int> cancel{};
+
+    for (int i = 0; i < 3; ++i)
+    {
+        // states of merge, take_until and disposables of this subscription share single arena
+        rpp::memory_model::use_arena arena{};
+        requests.get_observable()
+            | rpp::ops::merge_with(rpp::source::just(i))
+            | rpp::ops::take_until(cancel.get_observable())
+            | rpp::ops::subscribe([](int v) { std::cout << v << " "; });
+    }
+    requests.get_observer().on_next(10);
+    // arenas are released once their subscriptions are disposed
+    cancel.get_observer().on_next({});
+    std::cout << std::endl;
+
+    // Output: 0 1 2 10 10 10
+    //! [use_arena]
+    return 0;
+}
@@ -0,0 +1,35 @@
+#include <rpp/rpp.hpp>
+
+#include <array>
+#include <iostream>
+#include <memory_resource>
+
+/**
+ * @example use_memory_resource.cpp
+ **/
+
+int main() // NOLINT(bugprone-exception-escape)
+{
+    //! [use_memory_resource]
+    // buffer for internal containers of single request: released at once, no per-container heap allocations
+    std::array<std::byte, 4096>         buffer{};
+    std::pmr::monotonic_buffer_resource upstream{buffer.data(), buffer.size()};
+    // containers of different operators and subjects can allocate concurrently, so shared resource has to be thread-safe
+    std::pmr::synchronized_pool_resource resource{&upstream};
+
+    rpp::subjects::publish_subject<int> source{};
+    {
+        rpp::memory_model::use_memory_resource scope{&resource};
+        source.get_observable()
+            | rpp::ops::distinct()
+            | rpp::ops::zip(rpp::source::just(1, 2, 3))
+            | rpp::ops::subscribe([](const auto& v) { std::cout << std::get<0>(v) << ":" << std::get<1>(v) << " "; });
+    }
+    for (int v : {5, 5, 6, 7})
+        source.get_observer().on_next(v);
+    std::cout << std::endl;
+
+    // Output: 5:1 6:2 7:3
+    //! [use_memory_resource]
+    return 0;
+}
@@ -107,7 +107,7 @@ namespace rppasio::schedulers
                         m_schedulable->on_error(ep);
                     }
 
-                    std::shared_ptr<rpp::schedulers::details::schedulable_base> m_schedulable;
+                    rpp::schedulers::details::schedulable_ptr m_schedulable;
                 };
 
             private:
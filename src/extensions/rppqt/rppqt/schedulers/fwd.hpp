@@ -13,4 +13,5 @@
 namespace rppqt::schedulers
 {
     class main_thread;
+    class coalescing_main_thread_scheduler;
 } // namespace rppqt::schedulers
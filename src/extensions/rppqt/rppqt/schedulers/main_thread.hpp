@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include <rpp/schedulers/details/queue.hpp>  // schedulables_queue
 #include <rpp/schedulers/details/worker.hpp> // worker
 
 #include <rppqt/schedulers/fwd.hpp> // own forwarding
@@ -18,9 +19,14 @@
 #include "rpp/schedulers/fwd.hpp"
 
 #include <QCoreApplication>
+#include <QMetaObject>
 #include <QTimer>
+#include <algorithm>
 #include <chrono>
 #include <concepts>
+#include <memory>
+#include <mutex>
+#include <optional>
 
 namespace rppqt::schedulers
 {
@@ -82,4 +88,154 @@ namespace rppqt::schedulers
             return rpp::schedulers::worker<worker_strategy>{};
         }
     };
+
+    /**
+     * @brief Same as `main_thread_scheduler`, but coalesces schedulables instead of creating Qt timer and posted event for each of them.
+     * @details Schedulables are kept inside of internal queue, while main thread is woken up via single posted event (or single re-armed timer for the earliest delayed schedulable). Each wake-up executes all due schedulables in time_point order, but not longer than `options::turn_budget`: rest of them are left to the next turn of event loop, so UI stays responsive under flood of updates. At least one due schedulable is executed per wake-up anyway, so queue progresses even in case of late wake-up.
+     * @warning Each instance of scheduler has its own queue, so schedulables of workers of different instances are not ordered between each other.
+     * @ingroup qt_schedulers
+     */
+    class coalescing_main_thread_scheduler final
+    {
+    public:
+        struct options
+        {
+            /**
+             * @brief Maximum duration of draining of due schedulables per turn of event loop. Non-positive budget means single schedulable per turn.
+             */
+            rpp::schedulers::duration turn_budget{std::chrono::milliseconds{5}};
+        };
+
+    private:
+        class worker_strategy;
+
+        class state_t final : public std::enable_shared_from_this<state_t>
+        {
+        public:
+            explicit state_t(const options& opts)
+                : m_turn_budget{std::max(rpp::schedulers::duration::zero(), opts.turn_budget)}
+            {
+            }
+
+            template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, rpp::schedulers::constraint::schedulable_fn<Handler, Args...> Fn>
+            void defer_to(rpp::schedulers::time_point tp, Fn&& fn, Handler&& handler, Args&&... args)
+            {
+                const auto application = QCoreApplication::instance();
+                if (!application)
+                {
+                    handler.on_error(std::make_exception_ptr(utils::no_active_qapplication{"Pointer to application is null. Create QApplication before using coalescing_main_thread_scheduler!"}));
+                    return;
+                }
+
+                std::lock_guard lock{m_mutex};
+                m_queue.emplace(tp, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+                request_drain_unsafe(application, tp);
+            }
+
+        private:
+            // wakes up main thread at provided timepoint in case of no any earlier wake-up requested already. Previously requested later wake-up becomes stale and is ignored.
+            void request_drain_unsafe(QCoreApplication* application, rpp::schedulers::time_point tp)
+            {
+                if (m_requested_drain.has_value() && m_requested_drain.value() <= tp)
+                    return;
+
+                m_requested_drain = tp;
+                auto drain        = [weak = weak_from_this(), generation = ++m_drain_generation] {
+                    if (const auto self = weak.lock())
+                        self->drain(generation);
+                };
+
+                const auto delay = tp - rpp::schedulers::clock_type::now();
+                if (delay <= rpp::schedulers::duration::zero())
+                    QMetaObject::invokeMethod(application, std::move(drain), Qt::QueuedConnection);
+                else
+                    QTimer::singleShot(std::chrono::ceil<std::chrono::milliseconds>(delay), application, std::move(drain));
+            }
+
+            void drain(size_t generation)
+            {
+                const auto       start = rpp::schedulers::clock_type::now();
+                std::unique_lock lock{m_mutex};
+                if (generation != m_drain_generation)
+                    return;
+
+                m_requested_drain.reset();
+
+                bool executed_any{};
+                while (!m_queue.is_empty())
+                {
+                    if (m_queue.top()->is_disposed())
+                    {
+                        m_queue.pop();
+                        continue;
+                    }
+
+                    const auto now = rpp::schedulers::clock_type::now();
+                    if ((!m_queue.is_top_ready() && m_queue.top()->get_timepoint() > now) || (executed_any && now - start >= m_turn_budget))
+                        break;
+
+                    executed_any = true;
+                    auto top     = m_queue.pop();
+                    lock.unlock();
+                    const auto next_timepoint = (*top)();
+                    lock.lock();
+
+                    if (next_timepoint && !top->is_disposed())
+                        m_queue.emplace(next_timepoint.value(), std::move(top));
+                }
+
+                if (const auto application = QCoreApplication::instance(); application && !m_queue.is_empty())
+                    request_drain_unsafe(application, m_queue.top()->get_timepoint());
+            }
+
+        private:
+            const rpp::schedulers::duration                               m_turn_budget;
+            std::mutex                                                    m_mutex{};
+            rpp::schedulers::details::schedulables_queue<worker_strategy> m_queue{};
+            std::optional<rpp::schedulers::time_point>                    m_requested_drain{};
+            size_t                                                        m_drain_generation{};
+        };
+
+        class worker_strategy
+        {
+        public:
+            explicit worker_strategy(std::shared_ptr<state_t> state)
+                : m_state{std::move(state)}
+            {
+            }
+
+            template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, rpp::schedulers::constraint::schedulable_fn<Handler, Args...> Fn>
+            void defer_to(rpp::schedulers::time_point tp, Fn&& fn, Handler&& handler, Args&&... args) const
+            {
+                m_state->defer_to(tp, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+            }
+
+            static constexpr bool is_queue_based = true;
+            static constexpr bool is_real_clock  = true;
+
+            static rpp::schedulers::time_point now() { return rpp::schedulers::clock_type::now(); }
+
+        private:
+            std::shared_ptr<state_t> m_state;
+        };
+
+    public:
+        coalescing_main_thread_scheduler()
+            : coalescing_main_thread_scheduler{options{}}
+        {
+        }
+
+        explicit coalescing_main_thread_scheduler(const options& opts)
+            : m_state{std::make_shared<state_t>(opts)}
+        {
+        }
+
+        auto create_worker() const
+        {
+            return rpp::schedulers::worker<worker_strategy>{m_state};
+        }
+
+    private:
+        std::shared_ptr<state_t> m_state;
+    };
 } // namespace rppqt::schedulers
@@ -12,6 +12,7 @@
 
 #include <rpp/disposables/fwd.hpp>
 
+#include <rpp/disposables/details/base_disposable.hpp>
 #include <rpp/disposables/details/container.hpp>
 #include <rpp/disposables/disposable_wrapper.hpp>
 #include <rpp/disposables/interface_composite_disposable.hpp>
@@ -28,6 +29,7 @@ namespace rpp
      */
     template<details::disposables::constraint::disposables_container Container>
     class composite_disposable_impl : public interface_composite_disposable
+        , public details::disposed_flag_mirror
     {
     public:
         composite_disposable_impl()                                           = default;
@@ -48,6 +50,7 @@ namespace rpp
                 // need to acquire possible state changing from `add`
                 if (m_current_state.compare_exchange_strong(expected, State::Disposed, std::memory_order::seq_cst))
                 {
+                    mirror_disposed();
                     composite_dispose_impl(mode);
 
                     m_disposables.dispose();
@@ -64,7 +67,7 @@ namespace rpp
 
         void add(disposable_wrapper disposable) override
         {
-            if (disposable.is_disposed() || disposable.lock().get() == this)
+            if (disposable.is_disposed() || details::lock_disposable(disposable).get() == this)
                 return;
 
             while (true)
@@ -95,6 +98,44 @@ namespace rpp
             }
         }
 
+        /**
+         * @brief Same as `add`, but returns handle to remove added disposable in O(1) via `remove(handle)`. Returned handle is empty in case of disposable was not added.
+         */
+        details::disposables::disposable_handle add_with_handle(disposable_wrapper disposable)
+            requires details::disposables::constraint::handle_disposables_container<Container>
+        {
+            if (disposable.is_disposed() || details::lock_disposable(disposable).get() == this)
+                return {};
+
+            while (true)
+            {
+                State expected{State::None};
+                // need to acquire possible disposables state changing from other `add`
+                if (m_current_state.compare_exchange_strong(expected, State::Edit, std::memory_order::seq_cst))
+                {
+                    details::disposables::disposable_handle handle{};
+                    try
+                    {
+                        handle = m_disposables.push_back(std::move(disposable));
+                    }
+                    catch (...)
+                    {
+                        m_current_state.store(State::None, std::memory_order::seq_cst);
+                        throw;
+                    }
+                    // need to propogate disposables state changing to others
+                    m_current_state.store(State::None, std::memory_order::seq_cst);
+                    return handle;
+                }
+
+                if (expected == State::Disposed)
+                {
+                    disposable.dispose();
+                    return {};
+                }
+            }
+        }
+
         void remove(const disposable_wrapper& disposable) override
         {
             while (true)
@@ -122,6 +163,27 @@ namespace rpp
             }
         }
 
+        void remove(const details::disposables::disposable_handle& handle)
+            requires details::disposables::constraint::handle_disposables_container<Container>
+        {
+            while (true)
+            {
+                State expected{State::None};
+                // need to acquire possible disposables state changing from other `add` or `remove`
+                if (m_current_state.compare_exchange_strong(expected, State::Edit, std::memory_order::seq_cst))
+                {
+                    // removal by handle never throws
+                    m_disposables.remove(handle);
+                    // need to propogate disposables state changing to others
+                    m_current_state.store(State::None, std::memory_order::seq_cst);
+                    return;
+                }
+
+                if (expected == State::Disposed)
+                    return;
+            }
+        }
+
         void clear() override
         {
             while (true)
@@ -18,8 +18,31 @@
 
 namespace rpp::details
 {
+    /**
+     * @brief Mixin for disposables mirroring their "disposed" state into flag kept by control block of `disposable_wrapper`.
+     * @details Flag outlives disposable itself, so non-owning wrapper can check `is_disposed()` via single atomic load instead of locking disposable.
+     */
+    class disposed_flag_mirror
+    {
+    public:
+        void bind_disposed_flag(std::atomic_bool& flag) noexcept { m_flag = &flag; }
+
+    protected:
+        disposed_flag_mirror() = default;
+
+        void mirror_disposed() const noexcept
+        {
+            if (m_flag)
+                m_flag->store(true, std::memory_order::seq_cst);
+        }
+
+    private:
+        std::atomic_bool* m_flag{};
+    };
+
     template<typename BaseInterface>
     class base_disposable_impl : public BaseInterface
+        , public disposed_flag_mirror
     {
     public:
         base_disposable_impl()                                = default;
@@ -37,7 +60,10 @@ namespace rpp::details
         {
             // just need atomicity, not guarding anything
             if (m_disposed.exchange(true, std::memory_order::seq_cst) == false)
+            {
+                mirror_disposed();
                 base_dispose_impl(mode);
+            }
         }
 
     protected:
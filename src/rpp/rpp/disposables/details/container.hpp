@@ -13,51 +13,131 @@
 #include <rpp/utils/exceptions.hpp>
 
 #include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <utility>
 #include <vector>
 
 namespace rpp::details::disposables
 {
+    /**
+     * @brief Handle of disposable added into `dynamic_disposables_container`. Generation protects from removal of another disposable placed into the same slot later.
+     */
+    struct disposable_handle
+    {
+        uint32_t index{std::numeric_limits<uint32_t>::max()};
+        uint32_t generation{};
+
+        bool operator==(const disposable_handle&) const = default;
+    };
+
     class dynamic_disposables_container
     {
+        static constexpr uint32_t s_occupied = std::numeric_limits<uint32_t>::max();
+        static constexpr uint32_t s_no_free  = s_occupied - 1;
+
+        struct slot
+        {
+            rpp::disposable_wrapper disposable = rpp::disposable_wrapper::empty();
+            uint32_t                generation{};
+            // index of next free slot or `s_occupied` if slot is used right now
+            uint32_t next_free{s_occupied};
+        };
+
     public:
         explicit dynamic_disposables_container() = default;
 
-        dynamic_disposables_container(const dynamic_disposables_container&)           = delete;
-        dynamic_disposables_container(dynamic_disposables_container&& other) noexcept = default;
+        dynamic_disposables_container(const dynamic_disposables_container&) = delete;
+        dynamic_disposables_container(dynamic_disposables_container&& other) noexcept
+            : m_data{std::move(other.m_data)}
+            , m_free_head{std::exchange(other.m_free_head, s_no_free)}
+        {
+        }
 
-        dynamic_disposables_container& operator=(const dynamic_disposables_container& other)     = delete;
-        dynamic_disposables_container& operator=(dynamic_disposables_container&& other) noexcept = default;
+        dynamic_disposables_container& operator=(const dynamic_disposables_container& other) = delete;
+        dynamic_disposables_container& operator=(dynamic_disposables_container&& other) noexcept
+        {
+            m_data      = std::move(other.m_data);
+            m_free_head = std::exchange(other.m_free_head, s_no_free);
+            return *this;
+        }
 
-        void push_back(const rpp::disposable_wrapper& d)
+        disposable_handle push_back(const rpp::disposable_wrapper& d)
         {
-            m_data.push_back(d);
+            return push_back(rpp::disposable_wrapper{d});
         }
 
-        void push_back(rpp::disposable_wrapper&& d)
+        disposable_handle push_back(rpp::disposable_wrapper&& d)
         {
-            m_data.push_back(std::move(d));
+            if (m_free_head == s_no_free)
+            {
+                if (m_data.size() >= s_no_free)
+                    throw rpp::utils::more_disposables_than_expected{"dynamic_disposables_container obtained more disposables than expected"};
+
+                m_data.push_back(slot{std::move(d)});
+                return disposable_handle{static_cast<uint32_t>(m_data.size() - 1), 0};
+            }
+
+            const auto index = m_free_head;
+            auto&      s     = m_data[index];
+            m_free_head      = s.next_free;
+            s.disposable     = std::move(d);
+            s.next_free      = s_occupied;
+            return disposable_handle{index, s.generation};
         }
 
+        /**
+         * @brief Removes all entries of disposable. Linear complexity, prefer `remove(disposable_handle)` if handle is known.
+         */
         void remove(const rpp::disposable_wrapper& d)
         {
-            m_data.erase(std::remove(m_data.begin(), m_data.end(), d), m_data.end());
+            for (uint32_t i = 0; i < m_data.size(); ++i)
+            {
+                if (m_data[i].next_free == s_occupied && m_data[i].disposable == d)
+                    release(i);
+            }
+        }
+
+        /**
+         * @brief Removes disposable by handle in O(1). Does nothing if disposable was already removed.
+         */
+        void remove(const disposable_handle& handle)
+        {
+            if (handle.index < m_data.size() && m_data[handle.index].next_free == s_occupied && m_data[handle.index].generation == handle.generation)
+                release(handle.index);
         }
 
         void dispose() const
         {
-            for (const auto& d : m_data)
+            for (const auto& s : m_data)
             {
-                d.dispose();
+                if (s.next_free == s_occupied)
+                    s.disposable.dispose();
             }
         }
 
         void clear()
         {
-            m_data.clear();
+            for (uint32_t i = 0; i < m_data.size(); ++i)
+            {
+                if (m_data[i].next_free == s_occupied)
+                    release(i);
+            }
+        }
+
+    private:
+        void release(uint32_t index)
+        {
+            auto& s = m_data[index];
+            // disposable can be destroyed right now, so slot has to be consistent before it
+            const auto disposable = std::exchange(s.disposable, rpp::disposable_wrapper::empty());
+            ++s.generation;
+            s.next_free = std::exchange(m_free_head, index);
         }
 
     private:
-        mutable std::vector<rpp::disposable_wrapper> m_data{};
+        mutable std::vector<slot> m_data{};
+        uint32_t                  m_free_head{s_no_free};
     };
 
     template<size_t Count>
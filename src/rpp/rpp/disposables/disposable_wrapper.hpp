@@ -13,11 +13,14 @@
 #include <rpp/disposables/fwd.hpp>
 
 #include <rpp/defs.hpp>
+#include <rpp/disposables/details/base_disposable.hpp>
 #include <rpp/disposables/interface_disposable.hpp>
+#include <rpp/memory_model.hpp>
 #include <rpp/utils/utils.hpp>
 
+#include <atomic>
 #include <memory>
-#include <variant>
+#include <utility>
 
 namespace rpp::details
 {
@@ -51,53 +54,414 @@ namespace rpp::details
         RPP_NO_UNIQUE_ADDRESS TDisposable m_data;
     };
 
+    /**
+     * @brief Intrusive control block of disposable created via `disposable_wrapper_impl::make`: disposable itself is placed right inside of block together with strong and weak counters.
+     * @details Disposable is destroyed when last strong reference is released, while memory of block is freed when last weak reference is released (all strong references together keep one weak reference).
+     * In case of disposable derived from `disposed_flag_mirror` block also keeps its "disposed" flag, so non-owning wrapper checks `is_disposed()` via single atomic load without locking of disposable.
+     */
+    class disposable_control_block
+    {
+    public:
+        disposable_control_block(const disposable_control_block&) = delete;
+        disposable_control_block(disposable_control_block&&)      = delete;
+
+        void add_ref() noexcept { m_strong.fetch_add(1, std::memory_order::relaxed); }
+
+        // increments strong counter only if disposable is still alive
+        bool try_add_ref() noexcept
+        {
+            auto current = m_strong.load(std::memory_order::relaxed);
+            while (current != 0)
+            {
+                if (m_strong.compare_exchange_weak(current, current + 1, std::memory_order::acquire, std::memory_order::relaxed))
+                    return true;
+            }
+            return false;
+        }
+
+        void release() noexcept
+        {
+            if (m_strong.fetch_sub(1, std::memory_order::acq_rel) == 1)
+            {
+                destroy();
+                release_weak();
+            }
+        }
+
+        void add_weak_ref() noexcept { m_weak.fetch_add(1, std::memory_order::relaxed); }
+
+        void release_weak() noexcept
+        {
+            if (m_weak.fetch_sub(1, std::memory_order::acq_rel) == 1)
+                deallocate();
+        }
+
+        size_t use_count() const noexcept { return m_strong.load(std::memory_order::relaxed); }
+
+        interface_disposable* get() const noexcept { return m_disposable; }
+
+        /**
+         * @brief Checks if disposable is disposed without locking it. Can be called while holding any (strong or weak) reference.
+         */
+        bool is_disposed() const noexcept
+        {
+            if (m_strong.load(std::memory_order::acquire) == 0)
+                return true;
+            if (m_mirrors_disposed)
+                return m_disposed.load(std::memory_order::seq_cst);
+
+            auto* self = const_cast<disposable_control_block*>(this);
+            if (!self->try_add_ref())
+                return true;
+
+            const bool res = m_disposable->is_disposed();
+            self->release();
+            return res;
+        }
+
+    protected:
+        disposable_control_block()  = default;
+        ~disposable_control_block() = default;
+
+        template<typename TDisposable>
+        void init(TDisposable* disposable) noexcept
+        {
+            m_disposable = disposable;
+            if constexpr (std::derived_from<TDisposable, disposed_flag_mirror>)
+            {
+                m_disposed.store(static_cast<interface_disposable*>(disposable)->is_disposed(), std::memory_order::relaxed);
+                m_mirrors_disposed = true;
+                static_cast<disposed_flag_mirror*>(disposable)->bind_disposed_flag(m_disposed);
+            }
+        }
+
+        virtual void destroy() noexcept    = 0;
+        virtual void deallocate() noexcept = 0;
+
+    private:
+        std::atomic<size_t>   m_strong{1};
+        std::atomic<size_t>   m_weak{1};
+        interface_disposable* m_disposable{};
+        std::atomic_bool      m_disposed{};
+        bool                  m_mirrors_disposed{};
+    };
+
+    template<rpp::constraint::decayed_type TDisposable, typename Allocator>
+    class disposable_control_block_impl final : public disposable_control_block
+    {
+        using allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<disposable_control_block_impl>;
+
+    public:
+        template<typename... TArgs>
+        static disposable_control_block_impl* make(const Allocator& alloc, TArgs&&... args)
+        {
+            allocator a{alloc};
+            auto*     ptr = std::allocator_traits<allocator>::allocate(a, 1);
+            try
+            {
+                return ::new (ptr) disposable_control_block_impl(a, std::forward<TArgs>(args)...);
+            }
+            catch (...)
+            {
+                std::allocator_traits<allocator>::deallocate(a, ptr, 1);
+                throw;
+            }
+        }
+
+        TDisposable* get_disposable() noexcept { return m_wrapper.get(); }
+
+    private:
+        template<typename... TArgs>
+        explicit disposable_control_block_impl(const allocator& alloc, TArgs&&... args)
+            : m_wrapper{std::forward<TArgs>(args)...}
+            , m_allocator{alloc}
+        {
+            init(m_wrapper.get());
+        }
+
+        ~disposable_control_block_impl() noexcept {}
+
+        void destroy() noexcept override { std::destroy_at(&m_wrapper); }
+
+        void deallocate() noexcept override
+        {
+            allocator a{std::move(m_allocator)};
+            this->~disposable_control_block_impl();
+            std::allocator_traits<allocator>::deallocate(a, this, 1);
+        }
+
+    private:
+        // disposable is destroyed manually before the block itself
+        union
+        {
+            auto_dispose_wrapper<TDisposable> m_wrapper;
+        };
+        RPP_NO_UNIQUE_ADDRESS allocator m_allocator;
+    };
+
+    /**
+     * @brief Creates control block with disposable: from arena of current `rpp::memory_model::use_arena` scope if any, from the heap otherwise.
+     */
+    template<rpp::constraint::decayed_type TDisposable, typename... TArgs>
+    std::pair<disposable_control_block*, TDisposable*> make_disposable_control_block(TArgs&&... args)
+    {
+        if (auto* arena = s_current_arena)
+        {
+            auto* block = disposable_control_block_impl<TDisposable, subscription_arena_allocator<std::byte>>::make(subscription_arena_allocator<std::byte>{arena}, std::forward<TArgs>(args)...);
+            return {block, block->get_disposable()};
+        }
+        auto* block = disposable_control_block_impl<TDisposable, std::allocator<std::byte>>::make(std::allocator<std::byte>{}, std::forward<TArgs>(args)...);
+        return {block, block->get_disposable()};
+    }
+} // namespace rpp::details
+
+namespace rpp
+{
+    /**
+     * @brief Owning pointer to disposable (or any its part) kept by control block of `rpp::disposable_wrapper_impl`. Result of `rpp::details::lock_disposable`.
+     * @details Behaves like `std::shared_ptr` but shares intrusive counter of control block, so copying/locking doesn't allocate anything. Implicitly converts to `std::shared_ptr` for compatibility (such a conversion allocates separate control block of `std::shared_ptr`).
+     *
+     * @ingroup disposables
+     */
+    template<typename T>
+    class disposable_ptr
+    {
+        template<typename U>
+        friend class disposable_ptr;
+
+    public:
+        disposable_ptr() = default;
+
+        disposable_ptr(std::nullptr_t) noexcept {}
+
+        /**
+         * @brief Adopts already acquired strong reference of block
+         */
+        disposable_ptr(T* ptr, details::disposable_control_block* block) noexcept
+            : m_ptr{ptr}
+            , m_block{block}
+        {
+        }
+
+        disposable_ptr(const disposable_ptr& other) noexcept
+            : m_ptr{other.m_ptr}
+            , m_block{other.m_block}
+        {
+            if (m_block)
+                m_block->add_ref();
+        }
+
+        disposable_ptr(disposable_ptr&& other) noexcept
+            : m_ptr{std::exchange(other.m_ptr, nullptr)}
+            , m_block{std::exchange(other.m_block, nullptr)}
+        {
+        }
+
+        template<typename U>
+            requires std::convertible_to<U*, T*>
+        disposable_ptr(const disposable_ptr<U>& other) noexcept
+            : m_ptr{other.m_ptr}
+            , m_block{other.m_block}
+        {
+            if (m_block)
+                m_block->add_ref();
+        }
+
+        template<typename U>
+            requires std::convertible_to<U*, T*>
+        disposable_ptr(disposable_ptr<U>&& other) noexcept
+            : m_ptr{std::exchange(other.m_ptr, nullptr)}
+            , m_block{std::exchange(other.m_block, nullptr)}
+        {
+        }
+
+        ~disposable_ptr() noexcept
+        {
+            if (m_block)
+                m_block->release();
+        }
+
+        disposable_ptr& operator=(const disposable_ptr& other) noexcept
+        {
+            disposable_ptr{other}.swap(*this);
+            return *this;
+        }
+
+        disposable_ptr& operator=(disposable_ptr&& other) noexcept
+        {
+            disposable_ptr{std::move(other)}.swap(*this);
+            return *this;
+        }
+
+        void swap(disposable_ptr& other) noexcept
+        {
+            std::swap(m_ptr, other.m_ptr);
+            std::swap(m_block, other.m_block);
+        }
+
+        void reset() noexcept { disposable_ptr{}.swap(*this); }
+
+        T* get() const noexcept { return m_ptr; }
+        T* operator->() const noexcept { return m_ptr; }
+        T& operator*() const noexcept { return *m_ptr; }
+
+        explicit operator bool() const noexcept { return m_ptr != nullptr; }
+
+        size_t use_count() const noexcept { return m_block ? m_block->use_count() : 0; }
+
+        template<typename U>
+        bool operator==(const disposable_ptr<U>& other) const noexcept
+        {
+            return m_ptr == other.m_ptr;
+        }
+
+        bool operator==(std::nullptr_t) const noexcept { return m_ptr == nullptr; }
+
+        template<typename U>
+            requires std::convertible_to<T*, U*>
+        operator std::shared_ptr<U>() const
+        {
+            if (!m_block)
+                return {};
+
+            m_block->add_ref();
+            return std::shared_ptr<U>{m_ptr, [block = m_block](U*) noexcept { block->release(); }};
+        }
+
+    private:
+        T*                                 m_ptr{};
+        details::disposable_control_block* m_block{};
+    };
+} // namespace rpp
+
+namespace rpp::details
+{
     class disposable_wrapper_base
     {
     public:
         bool operator==(const disposable_wrapper_base& other) const
         {
-            return get().first == other.get().first;
+            return get_raw() == other.get_raw();
         }
 
         bool is_disposed() const noexcept
         {
-            if (const auto locked = get().first)
-                return locked->is_disposed();
-            return true;
+            if (!m_block)
+                return true;
+            if (m_is_strong)
+                return m_block->get()->is_disposed();
+            return m_block->is_disposed();
         }
 
         void dispose() const noexcept
         {
-            if (const auto locked = get().first)
-                locked->dispose();
+            if (auto* block = acquire())
+            {
+                block->get()->dispose();
+                block->release();
+            }
         }
 
     protected:
-        explicit disposable_wrapper_base(std::shared_ptr<interface_disposable>&& disposable)
-            : m_disposable{std::move(disposable)}
+        // adopts reference to block of required kind
+        disposable_wrapper_base(disposable_control_block* block, bool is_strong) noexcept
+            : m_block{block}
+            , m_is_strong{is_strong}
         {
         }
 
-        explicit disposable_wrapper_base(std::weak_ptr<interface_disposable>&& disposable)
-            : m_disposable{std::move(disposable)}
+        disposable_wrapper_base() = default;
+
+        disposable_wrapper_base(const disposable_wrapper_base& other) noexcept
+            : m_block{other.m_block}
+            , m_is_strong{other.m_is_strong}
         {
+            add_ref();
         }
 
-        disposable_wrapper_base() = default;
+        disposable_wrapper_base(disposable_wrapper_base&& other) noexcept
+            : m_block{std::exchange(other.m_block, nullptr)}
+            , m_is_strong{other.m_is_strong}
+        {
+        }
+
+        disposable_wrapper_base& operator=(const disposable_wrapper_base& other) noexcept
+        {
+            if (this != &other)
+            {
+                release();
+                m_block     = other.m_block;
+                m_is_strong = other.m_is_strong;
+                add_ref();
+            }
+            return *this;
+        }
 
-        std::pair<std::shared_ptr<interface_disposable>, bool> get() const noexcept
+        disposable_wrapper_base& operator=(disposable_wrapper_base&& other) noexcept
         {
-            if (const auto ptr_ptr = std::get_if<std::shared_ptr<interface_disposable>>(&m_disposable))
-                return {*ptr_ptr, true};
+            if (this != &other)
+            {
+                release();
+                m_block     = std::exchange(other.m_block, nullptr);
+                m_is_strong = other.m_is_strong;
+            }
+            return *this;
+        }
 
-            if (const auto ptr_ptr = std::get_if<std::weak_ptr<interface_disposable>>(&m_disposable))
-                return {ptr_ptr->lock(), false};
+        ~disposable_wrapper_base() noexcept { release(); }
 
-            return {nullptr, true};
+        /**
+         * @brief Locks disposable: returns block with acquired strong reference or nullptr in case of disposable is empty/gone
+         */
+        disposable_control_block* acquire() const noexcept
+        {
+            if (!m_block)
+                return nullptr;
+
+            if (m_is_strong)
+            {
+                m_block->add_ref();
+                return m_block;
+            }
+            return m_block->try_add_ref() ? m_block : nullptr;
         }
 
+        disposable_control_block* get_block() const noexcept { return m_block; }
+
+        bool is_strong() const noexcept { return m_is_strong; }
+
     private:
-        std::variant<std::monostate, std::shared_ptr<interface_disposable>, std::weak_ptr<interface_disposable>> m_disposable;
+        // pointer to disposable without locking, valid only for comparison
+        const interface_disposable* get_raw() const noexcept
+        {
+            if (!m_block || (!m_is_strong && m_block->use_count() == 0))
+                return nullptr;
+            return m_block->get();
+        }
+
+        void add_ref() const noexcept
+        {
+            if (!m_block)
+                return;
+            if (m_is_strong)
+                m_block->add_ref();
+            else
+                m_block->add_weak_ref();
+        }
+
+        void release() const noexcept
+        {
+            if (!m_block)
+                return;
+            if (m_is_strong)
+                m_block->release();
+            else
+                m_block->release_weak();
+        }
+
+    private:
+        disposable_control_block* m_block{};
+        bool                      m_is_strong{true};
     };
 
 } // namespace rpp::details
@@ -106,8 +470,8 @@ namespace rpp
 {
     /**
      * @brief Wrapper to keep disposable. Any disposable have to be created right from this wrapper with help of `make` function.
-     * @details Member functions is safe to call even if internal disposable is gone. Also  it provides access to "raw" shared_ptr and it can be nullptr in case of disposable empty/ptr gone.
-     * @details Can keep weak_ptr in case of not owning disposable
+     * @details Member functions is safe to call even if internal disposable is gone. Also  it provides access to "raw" owning pointer and it can be nullptr in case of disposable empty/ptr gone.
+     * @details Can keep weak reference in case of not owning disposable. Disposable and its strong/weak counters live in single intrusive control block, so copying of wrapper never allocates and `is_disposed()` of not owning wrapper is just atomic load for disposables derived from rpp's base disposables.
      *
      * @ingroup disposables
      */
@@ -123,6 +487,9 @@ namespace rpp
         template<rpp::constraint::decayed_type TTarget>
         friend class details::enable_wrapper_from_this;
 
+        template<rpp::constraint::decayed_type TTarget>
+        friend disposable_ptr<TTarget> details::lock_disposable(const disposable_wrapper_impl<TTarget>& d) noexcept;
+
         bool operator==(const disposable_wrapper_impl&) const = default;
 
         /**
@@ -132,13 +499,12 @@ namespace rpp
             requires (std::constructible_from<TTarget, TArgs && ...>)
         [[nodiscard]] static disposable_wrapper_impl make(TArgs&&... args)
         {
-            const auto ptr      = std::make_shared<details::auto_dispose_wrapper<TTarget>>(std::forward<TArgs>(args)...);
-            auto       base_ptr = std::shared_ptr<TDisposable>{ptr, static_cast<TDisposable*>(ptr->get())};
-            if constexpr (rpp::utils::is_base_of_v<TDisposable, rpp::details::enable_wrapper_from_this>)
+            const auto [block, ptr] = details::make_disposable_control_block<TTarget>(std::forward<TArgs>(args)...);
+            if constexpr (rpp::utils::is_base_of_v<TTarget, rpp::details::enable_wrapper_from_this>)
             {
-                base_ptr->set_weak_self(std::weak_ptr<interface_disposable>(base_ptr));
+                ptr->set_control_block(block);
             }
-            return disposable_wrapper_impl{std::static_pointer_cast<interface_disposable>(std::move(base_ptr))};
+            return disposable_wrapper_impl{block, true};
         }
 
         /**
@@ -181,16 +547,25 @@ namespace rpp
                 locked->clear();
         }
 
-        [[nodiscard]] std::shared_ptr<TDisposable> lock() const noexcept
+        /**
+         * @brief Returns owning pointer to disposable or nullptr in case of disposable is empty/gone.
+         * @details Returned `std::shared_ptr` has own control block referencing intrusive counter of disposable, so each call allocates it. Operators and subjects use `rpp::details::lock_disposable` returning `rpp::disposable_ptr` instead.
+         */
+        [[nodiscard]] std::shared_ptr<TDisposable> lock() const
         {
-            return std::static_pointer_cast<TDisposable>(get().first);
+            return details::lock_disposable(*this);
         }
 
         [[nodiscard]] disposable_wrapper_impl as_weak() const
         {
-            auto [locked, is_shared] = get();
-            if (is_shared)
-                return disposable_wrapper_impl{std::weak_ptr<interface_disposable>{locked}};
+            if (!get_block())
+                return disposable_wrapper_impl{};
+
+            if (is_strong())
+            {
+                get_block()->add_weak_ref();
+                return disposable_wrapper_impl{get_block(), false};
+            }
             return *this;
         }
 
@@ -198,15 +573,14 @@ namespace rpp
             requires rpp::constraint::static_pointer_convertible_to<TDisposable, TTarget>
         operator disposable_wrapper_impl<TTarget>() const
         {
-            auto [locked, is_shared] = get();
-            if (!locked)
+            if (!get_block())
                 return rpp::disposable_wrapper_impl<TTarget>::empty();
 
-            auto res = disposable_wrapper_impl<TTarget>{std::move(locked)};
-            if (is_shared)
-                return res;
-
-            return res.as_weak();
+            if (is_strong())
+                get_block()->add_ref();
+            else
+                get_block()->add_weak_ref();
+            return disposable_wrapper_impl<TTarget>{get_block(), is_strong()};
         }
 
     private:
@@ -226,18 +600,31 @@ namespace rpp::details
     protected:
         enable_wrapper_from_this() = default;
 
-        void set_weak_self(std::weak_ptr<interface_disposable> weak)
+        void set_control_block(disposable_control_block* block) noexcept
         {
-            m_weak = std::move(weak);
+            m_block = block;
         }
 
     public:
         disposable_wrapper_impl<TStrategy> wrapper_from_this() const
         {
-            return disposable_wrapper_impl<TStrategy>(std::static_pointer_cast<interface_disposable>(m_weak.lock()));
+            if (m_block && m_block->try_add_ref())
+                return disposable_wrapper_impl<TStrategy>{m_block, true};
+            return disposable_wrapper_impl<TStrategy>::empty();
         }
 
     private:
-        std::weak_ptr<interface_disposable> m_weak{};
+        // not owning: disposable is placed inside of this block
+        disposable_control_block* m_block{};
     };
+
+    /**
+     * @brief Same as `rpp::disposable_wrapper_impl::lock()`, but returns `rpp::disposable_ptr` sharing intrusive counter of disposable, so it never allocates.
+     */
+    template<rpp::constraint::decayed_type TDisposable>
+    disposable_ptr<TDisposable> lock_disposable(const disposable_wrapper_impl<TDisposable>& d) noexcept
+    {
+        auto* block = d.acquire();
+        return disposable_ptr<TDisposable>{block ? static_cast<TDisposable*>(block->get()) : nullptr, block};
+    }
 } // namespace rpp::details
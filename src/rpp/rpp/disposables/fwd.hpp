@@ -26,6 +26,9 @@ namespace rpp
     template<rpp::constraint::decayed_type TDisposable>
     class disposable_wrapper_impl;
 
+    template<typename T>
+    class disposable_ptr;
+
     /**
      * @brief Wrapper to keep "simple" disposable. Specialization of rpp::disposable_wrapper_impl
      *
@@ -41,6 +44,12 @@ namespace rpp
     using composite_disposable_wrapper = disposable_wrapper_impl<interface_composite_disposable>;
 } // namespace rpp
 
+namespace rpp::details
+{
+    template<rpp::constraint::decayed_type TDisposable>
+    disposable_ptr<TDisposable> lock_disposable(const disposable_wrapper_impl<TDisposable>& d) noexcept;
+} // namespace rpp::details
+
 namespace rpp::details::disposables
 {
     namespace constraint
@@ -53,8 +62,22 @@ namespace rpp::details::disposables
         };
     } // namespace constraint
 
+    struct disposable_handle;
+
+    namespace constraint
+    {
+        /**
+         * @brief Container returning handle from `push_back` to remove disposable in O(1) via `remove(handle)`
+         */
+        template<typename T>
+        concept handle_disposables_container = disposables_container<T> && requires(T& c, const rpp::disposable_wrapper& d, const disposable_handle& h) {
+            { c.push_back(d) } -> std::same_as<disposable_handle>;
+            c.remove(h);
+        };
+    } // namespace constraint
+
     /**
-     * @brief Container with std::vector as underlying storage.
+     * @brief Container with std::vector based slot-map as underlying storage.
      */
     class dynamic_disposables_container;
 
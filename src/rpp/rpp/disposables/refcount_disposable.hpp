@@ -78,18 +78,25 @@ namespace rpp::details
         {
         }
 
-        void composite_dispose_impl(interface_disposable::Mode mode) noexcept override
+        void set_handle(const disposables::disposable_handle& handle) noexcept
         {
-            if (mode != interface_disposable::Mode::Destroying)
-                m_state.remove(this->wrapper_from_this());
+            m_handle.store(handle, std::memory_order::seq_cst);
+        }
 
-            if (const auto locked = m_state.lock())
+        void composite_dispose_impl(interface_disposable::Mode) noexcept override
+        {
+            if (const auto locked = details::lock_disposable(m_state))
+            {
+                locked->remove(m_handle.load(std::memory_order::seq_cst));
                 locked->release();
+            }
             m_state = disposable_wrapper_impl<refcount_disposable>::empty();
         }
 
     private:
         disposable_wrapper_impl<refcount_disposable> m_state;
+        // handle of this disposable inside of `m_state`, so it is removed in O(1). Atomic due to `m_state` can dispose this one before handle is set.
+        std::atomic<disposables::disposable_handle> m_handle{};
     };
 
 } // namespace rpp::details
@@ -107,8 +114,10 @@ namespace rpp
             // just need atomicity, not guarding anything
             if (m_refcount.compare_exchange_strong(current_value, current_value + 1, std::memory_order::seq_cst))
             {
-                auto inner = composite_disposable_wrapper::make<details::refocunt_disposable_inner>(mode == Mode::WeakRefStrongSource ? wrapper_from_this() : wrapper_from_this().as_weak());
-                add(mode == Mode::WeakRefStrongSource ? inner.as_weak() : inner);
+                const auto inner  = disposable_wrapper_impl<details::refocunt_disposable_inner>::make(mode == Mode::WeakRefStrongSource ? wrapper_from_this() : wrapper_from_this().as_weak());
+                const auto handle = add_with_handle(mode == Mode::WeakRefStrongSource ? inner.as_weak() : inner);
+                if (const auto locked = details::lock_disposable(inner))
+                    locked->set_handle(handle);
                 return inner;
             }
         }
@@ -10,7 +10,17 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <concepts>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <utility>
 
 namespace rpp::memory_model
 {
@@ -25,6 +35,301 @@ namespace rpp::memory_model
     };
 } // namespace rpp::memory_model
 
+namespace rpp::details
+{
+    /**
+     * @brief Monotonic arena for states of operators and disposables of single subscription.
+     * @details Memory is taken from chunks with plain pointer bump and never reused: deallocation of block just releases reference to arena and all chunks are freed at once when last block and owning scope are gone. First chunk is placed right after arena itself, so whole arena costs single heap allocation in most cases.
+     * Blocks are allocated only by thread of owning `use_arena` scope while it is alive, so bumping needs no synchronization. Blocks can be deallocated from any thread.
+     * When arena reaches its max size, allocations fall back to the heap.
+     */
+    class alignas(std::max_align_t) subscription_arena final
+    {
+        static constexpr size_t s_max_chunks = 16;
+        static constexpr size_t s_owner_bias = std::numeric_limits<size_t>::max() / 2;
+
+        struct chunk
+        {
+            std::byte* data;
+            size_t     size;
+        };
+
+    public:
+        static subscription_arena* create(size_t chunk_size, size_t max_size)
+        {
+            constexpr size_t alignment = alignof(std::max_align_t);
+
+            chunk_size = (std::max(chunk_size, alignment) + alignment - 1) / alignment * alignment;
+            return ::new (::operator new(sizeof(subscription_arena) + chunk_size)) subscription_arena(chunk_size, max_size);
+        }
+
+        subscription_arena(const subscription_arena&) = delete;
+        subscription_arena(subscription_arena&&)      = delete;
+
+        /**
+         * @brief Releases reference of owning scope: arena is destroyed right now if all its blocks are already deallocated or by deallocation of last block otherwise.
+         */
+        void release_owner() noexcept
+        {
+            // bias is replaced with actual amount of allocated blocks
+            release(s_owner_bias - m_allocated_count);
+        }
+
+        void* allocate(size_t size, size_t alignment)
+        {
+            ++m_allocated_count;
+
+            if (alignment <= alignof(std::max_align_t))
+            {
+                if (void* ptr = bump(size, alignment))
+                    return ptr;
+                if (void* ptr = allocate_from_new_chunk(size, alignment))
+                    return ptr;
+            }
+            return ::operator new(size, std::align_val_t{alignment});
+        }
+
+        void deallocate(void* ptr, size_t size, size_t alignment) noexcept
+        {
+            if (!owns(ptr))
+                ::operator delete(ptr, size, std::align_val_t{alignment});
+            release(1);
+        }
+
+        /**
+         * @brief Amount of bytes handed out from chunks of arena (heap fallbacks are not counted). Can be called only from owning thread.
+         */
+        size_t get_used_size() const { return m_used_size; }
+
+    private:
+        subscription_arena(size_t chunk_size, size_t max_size)
+            : m_current{reinterpret_cast<std::byte*>(this + 1)}
+            , m_remaining{chunk_size}
+            , m_reserved_size{chunk_size}
+            , m_next_chunk_size{2 * chunk_size}
+            , m_max_size{max_size}
+        {
+            m_chunks[0] = chunk{m_current, chunk_size};
+        }
+
+        ~subscription_arena() noexcept
+        {
+            for (size_t i = 1; i < m_chunks_count.load(std::memory_order_relaxed); ++i)
+                delete[] m_chunks[i].data;
+        }
+
+        void release(size_t count) noexcept
+        {
+            if (m_refs.fetch_sub(count, std::memory_order_acq_rel) == count)
+            {
+                this->~subscription_arena();
+                ::operator delete(this);
+            }
+        }
+
+        void* bump(size_t size, size_t alignment)
+        {
+            void* ptr = m_current;
+            if (!std::align(alignment, size, ptr, m_remaining))
+                return nullptr;
+
+            m_current = static_cast<std::byte*>(ptr) + size;
+            m_remaining -= size;
+            m_used_size += size;
+            return ptr;
+        }
+
+        void* allocate_from_new_chunk(size_t size, size_t alignment)
+        {
+            const size_t count      = m_chunks_count.load(std::memory_order_relaxed);
+            const size_t chunk_size = std::max(m_next_chunk_size, size + alignment);
+            if (count == s_max_chunks || m_reserved_size + chunk_size > m_max_size)
+                return nullptr;
+
+            m_chunks[count] = chunk{new std::byte[chunk_size], chunk_size};
+            // chunk has to be visible to threads deallocating blocks from it
+            m_chunks_count.store(count + 1, std::memory_order_release);
+
+            m_current   = m_chunks[count].data;
+            m_remaining = chunk_size;
+            m_reserved_size += chunk_size;
+            m_next_chunk_size *= 2;
+            return bump(size, alignment);
+        }
+
+        bool owns(const void* ptr) const
+        {
+            const auto*  byte  = static_cast<const std::byte*>(ptr);
+            const size_t count = m_chunks_count.load(std::memory_order_acquire);
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (std::less_equal<>{}(m_chunks[i].data, byte) && std::less<>{}(byte, m_chunks[i].data + m_chunks[i].size))
+                    return true;
+            }
+            return false;
+        }
+
+    private:
+        // while owning scope is alive, it keeps huge bias instead of counting each allocated block atomically: deallocations can't drop it to zero, so owning thread only bumps plain counter
+        std::atomic<size_t>             m_refs{s_owner_bias};
+        size_t                          m_allocated_count{};
+        std::array<chunk, s_max_chunks> m_chunks{};
+        std::atomic<size_t>             m_chunks_count{1};
+        std::byte*                      m_current;
+        size_t                          m_remaining;
+        size_t                          m_used_size{};
+        size_t                          m_reserved_size;
+        size_t                          m_next_chunk_size;
+        const size_t                    m_max_size;
+    };
+
+    template<typename T>
+    class subscription_arena_allocator
+    {
+    public:
+        using value_type = T;
+
+        explicit subscription_arena_allocator(subscription_arena* arena)
+            : m_arena{arena}
+        {
+        }
+
+        template<typename U>
+        subscription_arena_allocator(const subscription_arena_allocator<U>& other)
+            : m_arena{other.m_arena}
+        {
+        }
+
+        T* allocate(size_t n) { return static_cast<T*>(m_arena->allocate(n * sizeof(T), alignof(T))); }
+
+        void deallocate(T* ptr, size_t n) noexcept { m_arena->deallocate(ptr, n * sizeof(T), alignof(T)); }
+
+        template<typename U>
+        bool operator==(const subscription_arena_allocator<U>& other) const
+        {
+            return m_arena == other.m_arena;
+        }
+
+    private:
+        template<typename U>
+        friend class subscription_arena_allocator;
+
+        subscription_arena* m_arena;
+    };
+
+    // arena of innermost alive `rpp::memory_model::use_arena` of current thread
+    inline thread_local subscription_arena* s_current_arena{};
+
+    /**
+     * @brief Creates shared state of subscription: from arena of current `use_arena` scope if any, from the heap otherwise.
+     */
+    template<typename T, typename... Args>
+    std::shared_ptr<T> make_shared_state(Args&&... args)
+    {
+        if (auto* arena = s_current_arena)
+            return std::allocate_shared<T>(subscription_arena_allocator<T>{arena}, std::forward<Args>(args)...);
+        return std::make_shared<T>(std::forward<Args>(args)...);
+    }
+
+    // resource of innermost alive `rpp::memory_model::use_memory_resource` of current thread
+    inline thread_local std::pmr::memory_resource* s_current_memory_resource{};
+
+    /**
+     * @brief Memory resource for internal containers of operators/subjects being created right now: resource of current `use_memory_resource` scope if any, `std::pmr::get_default_resource()` otherwise.
+     */
+    inline std::pmr::memory_resource* current_memory_resource()
+    {
+        if (auto* resource = s_current_memory_resource)
+            return resource;
+        return std::pmr::get_default_resource();
+    }
+} // namespace rpp::details
+
+namespace rpp::memory_model
+{
+    /**
+     * @brief Scope making all subscriptions performed in it on current thread to allocate states of operators and disposables from single arena instead of separate heap allocation per each of them.
+     * @details Arena is released when scope is finished and all states allocated from it are destroyed (subscription is disposed/completed). Memory of arena is never reused while it is alive, so arena is limited by `options::max_size`: allocations beyond it go to the heap as usual.
+     * Only allocations performed on the thread of scope are affected: states of subscriptions made later (e.g. inner observables of `merge` emitted from other thread) are allocated from the heap.
+     *
+     * @warning Single long-living state keeps whole arena alive, so scope is meant for subscriptions with states of the same lifetime.
+     *
+     * @par Example
+     * @snippet use_arena.cpp use_arena
+     */
+    class use_arena final
+    {
+    public:
+        struct options
+        {
+            /**
+             * @brief Size of first chunk of arena. Each next chunk is twice bigger than previous one.
+             */
+            size_t chunk_size{1024};
+            /**
+             * @brief Total size of chunks of arena
+             */
+            size_t max_size{64 * 1024};
+        };
+
+        use_arena()
+            : use_arena{options{}}
+        {
+        }
+
+        explicit use_arena(const options& opts)
+            : m_arena{details::subscription_arena::create(opts.chunk_size, opts.max_size)}
+            , m_previous{std::exchange(details::s_current_arena, m_arena)}
+        {
+        }
+
+        ~use_arena() noexcept
+        {
+            details::s_current_arena = m_previous;
+            m_arena->release_owner();
+        }
+
+        use_arena(const use_arena&) = delete;
+        use_arena(use_arena&&)      = delete;
+
+        /**
+         * @brief Amount of bytes allocated from arena so far
+         */
+        size_t get_used_size() const { return m_arena->get_used_size(); }
+
+    private:
+        details::subscription_arena* m_arena;
+        details::subscription_arena* m_previous;
+    };
+
+    /**
+     * @brief Scope providing memory resource for internal containers of operators and subjects created in it on current thread.
+     * @details Resource is captured when container is created: by operators during subscription (pendings of `zip`, queue of `delay`, groups of `group_by`, past values of `distinct`) and by subjects during construction (observers of any subject, buffer of `replay_subject`). Containers keep using captured resource after end of scope, so resource has to outlive subscriptions and subjects created in the scope.
+     * Without scope containers use `std::pmr::get_default_resource()`.
+     *
+     * @warning Captured resource is shared by containers guarded by different locks (each subject and each subscription has own one), so they can allocate from it concurrently. Resource has to be thread-safe (like `std::pmr::synchronized_pool_resource`) unless all subscriptions and subjects created in the scope are used from single thread only.
+     *
+     * @par Example
+     * @snippet use_memory_resource.cpp use_memory_resource
+     */
+    class use_memory_resource final
+    {
+    public:
+        explicit use_memory_resource(std::pmr::memory_resource* resource)
+            : m_previous{std::exchange(details::s_current_memory_resource, resource)}
+        {
+        }
+
+        ~use_memory_resource() noexcept { details::s_current_memory_resource = m_previous; }
+
+        use_memory_resource(const use_memory_resource&) = delete;
+        use_memory_resource(use_memory_resource&&)      = delete;
+
+    private:
+        std::pmr::memory_resource* m_previous;
+    };
+} // namespace rpp::memory_model
+
 namespace rpp::constraint
 {
     template<typename T>
@@ -68,7 +68,7 @@ namespace rpp::details::observables
             m_original.subscribe(std::move(obs));
 
             if (!d.is_disposed())
-                if (const auto locked = d.lock())
+                if (const auto locked = rpp::details::lock_disposable(d))
                     locked->wait();
         }
 
@@ -53,10 +53,10 @@ namespace rpp::details
         {
             std::unique_lock lock(m_state->mutex);
             if (!m_state->disposable.is_disposed())
-                return {m_state->disposable.lock()->add_ref(), composite_disposable_wrapper::empty()};
+                return {rpp::details::lock_disposable(m_state->disposable)->add_ref(), composite_disposable_wrapper::empty()};
 
             m_state->disposable = disposable_wrapper_impl<rpp::refcount_disposable>::make();
-            return {m_state->disposable.lock()->add_ref(), m_state->disposable};
+            return {rpp::details::lock_disposable(m_state->disposable)->add_ref(), m_state->disposable};
         }
     };
 } // namespace rpp::details
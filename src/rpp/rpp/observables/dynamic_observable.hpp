@@ -14,21 +14,60 @@
 
 #include <rpp/observables/observable.hpp>
 #include <rpp/observers/dynamic_observer.hpp>
+#include <rpp/utils/small_buffer.hpp>
 
 #include <memory>
+#include <type_traits>
 #include <utility>
 
 namespace rpp::details::observables
 {
-    template<typename T, typename Observable>
-    void forwarding_subscribe(const void* const ptr, dynamic_observer<T>&& obs)
-    {
-        static_cast<const Observable*>(ptr)->subscribe(std::move(obs));
-    }
-
     template<rpp::constraint::decayed_type Type>
     class dynamic_strategy final
     {
+        using storage         = rpp::utils::small_buffer<4 * sizeof(void*)>;
+        using erased_observer = observer<Type, rpp::details::observers::unique_dynamic_strategy<Type>>;
+
+        struct vtable
+        {
+            void (*subscribe)(const storage&, erased_observer&&){};
+
+            void (*copy)(const storage& from, storage& to){};
+            void (*relocate)(storage& from, storage& to) noexcept {};
+            void (*destroy)(storage&) noexcept {};
+
+            template<typename Holder>
+            static const vtable* create() noexcept
+            {
+                static const vtable s_res{
+                    .subscribe = +[](const storage& s, erased_observer&& obs) { Holder::get(s).subscribe(std::move(obs)); },
+                    .copy      = +[](const storage& from, storage& to) { to.template emplace<typename Holder::stored_type>(from.template get<typename Holder::stored_type>()); },
+                    .relocate  = +[](storage& from, storage& to) noexcept { from.template relocate_to<typename Holder::stored_type>(to); },
+                    .destroy   = +[](storage& s) noexcept { s.template destroy<typename Holder::stored_type>(); }};
+                return &s_res;
+            }
+        };
+
+        template<typename Observable>
+        struct inline_holder
+        {
+            using stored_type = Observable;
+
+            static const Observable& get(const storage& s) noexcept { return s.template get<Observable>(); }
+        };
+
+        template<typename Observable>
+        struct shared_holder
+        {
+            using stored_type = std::shared_ptr<const Observable>;
+
+            static const Observable& get(const storage& s) noexcept { return *s.template get<stored_type>(); }
+        };
+
+        // observable is placed inline only if it can be copied, otherwise copies of dynamic_observable share it
+        template<typename Observable>
+        static constexpr bool is_inline = storage::template fits<Observable> && std::is_copy_constructible_v<Observable>;
+
     public:
         using value_type                   = Type;
         using optimal_disposables_strategy = rpp::details::observables::default_disposables_strategy;
@@ -36,42 +75,91 @@ namespace rpp::details::observables
         template<rpp::constraint::observable_strategy<Type> Strategy>
             requires (!rpp::constraint::decayed_same_as<Strategy, dynamic_strategy<Type>>)
         explicit dynamic_strategy(observable<Type, Strategy>&& obs)
-            : m_forwarder{std::make_shared<observable<Type, Strategy>>(std::move(obs))}
-            , m_vtable{vtable::template create<observable<Type, Strategy>>()}
         {
+            emplace<observable<Type, Strategy>>(std::move(obs));
         }
 
         template<rpp::constraint::observable_strategy<Type> Strategy>
             requires (!rpp::constraint::decayed_same_as<Strategy, dynamic_strategy<Type>>)
         explicit dynamic_strategy(const observable<Type, Strategy>& obs)
-            : m_forwarder{std::make_shared<observable<Type, Strategy>>(obs)}
-            , m_vtable{vtable::template create<observable<Type, Strategy>>()}
         {
+            emplace<observable<Type, Strategy>>(obs);
+        }
+
+        dynamic_strategy(const dynamic_strategy& other)
+            : m_vtable{other.m_vtable}
+        {
+            if (m_vtable)
+                m_vtable->copy(other.m_storage, m_storage);
+        }
+
+        dynamic_strategy(dynamic_strategy&& other) noexcept
+            : m_vtable{std::exchange(other.m_vtable, nullptr)}
+        {
+            if (m_vtable)
+                m_vtable->relocate(other.m_storage, m_storage);
+        }
+
+        dynamic_strategy& operator=(const dynamic_strategy& other)
+        {
+            if (this != &other)
+                *this = dynamic_strategy{other};
+            return *this;
+        }
+
+        dynamic_strategy& operator=(dynamic_strategy&& other) noexcept
+        {
+            if (this != &other)
+            {
+                reset();
+                m_vtable = std::exchange(other.m_vtable, nullptr);
+                if (m_vtable)
+                    m_vtable->relocate(other.m_storage, m_storage);
+            }
+            return *this;
+        }
+
+        ~dynamic_strategy() noexcept
+        {
+            reset();
         }
 
         template<rpp::constraint::observer_strategy<Type> ObserverStrategy>
         void subscribe(observer<Type, ObserverStrategy>&& observer) const
         {
-            m_vtable->subscribe(m_forwarder.get(), std::move(observer).as_dynamic());
+            // observer is erased via move-only wrapper: it is placed inline and moved to shared storage only if observable copies it
+            if constexpr (std::same_as<ObserverStrategy, rpp::details::observers::unique_dynamic_strategy<Type>>)
+                m_vtable->subscribe(m_storage, std::move(observer));
+            else
+                m_vtable->subscribe(m_storage, erased_observer{std::move(observer)});
         }
 
     private:
-        struct vtable
+        template<typename Observable, typename... Args>
+        void emplace(Args&&... args)
         {
-            void (*subscribe)(const void*, dynamic_observer<Type>&&){};
-
-            template<rpp::constraint::observable Observable>
-            static const vtable* create() noexcept
+            if constexpr (is_inline<Observable>)
             {
-                static vtable s_res{
-                    .subscribe = forwarding_subscribe<Type, Observable>};
-                return &s_res;
+                m_storage.template emplace<Observable>(std::forward<Args>(args)...);
+                m_vtable = vtable::template create<inline_holder<Observable>>();
             }
-        };
+            else
+            {
+                m_storage.template emplace<std::shared_ptr<const Observable>>(std::make_shared<Observable>(std::forward<Args>(args)...));
+                m_vtable = vtable::template create<shared_holder<Observable>>();
+            }
+        }
+
+        void reset() noexcept
+        {
+            if (const auto* v = std::exchange(m_vtable, nullptr))
+                v->destroy(m_storage);
+        }
 
     private:
-        std::shared_ptr<void> m_forwarder;
-        const vtable*         m_vtable;
+        // observable is placed inline if it fits, `std::shared_ptr` to it otherwise
+        storage       m_storage{};
+        const vtable* m_vtable{};
     };
 } // namespace rpp::details::observables
 
@@ -79,7 +167,7 @@ namespace rpp
 {
     /**
      * @brief Type-erased version of the `rpp::observable`. Any observable can be converted to dynamic_observable via `rpp::observable::as_dynamic` member function.
-     * @details To provide type-erasure it uses `std::shared_ptr`. As a result it has worse performance.
+     * @details Observable is placed into small inline buffer if it fits there and copyable, otherwise into `std::shared_ptr`. Observer is passed to it via move-only type-erasure with same small buffer, so it is moved to heap only if observable copies it. Anyway it has worse performance due to indirect calls.
      *
      * @tparam Type of value this obsevalbe can provide
      *
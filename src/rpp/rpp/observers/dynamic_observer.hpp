@@ -12,7 +12,9 @@
 #include <rpp/disposables/fwd.hpp>
 #include <rpp/observers/fwd.hpp>
 
+#include <rpp/memory_model.hpp>
 #include <rpp/observers/observer.hpp>
+#include <rpp/utils/small_buffer.hpp>
 
 #include <memory>
 #include <utility>
@@ -87,6 +89,144 @@ namespace rpp::details::observers
         RPP_NO_UNIQUE_ADDRESS TObs m_observer;
     };
 
+    /**
+     * @brief Move-only owner of type-erased observer. Observer is placed into small inline buffer if it fits there, otherwise into `std::shared_ptr`. Calls are dispatched via static table of function pointers.
+     * @details Only single owner exists, so inline observer is never shared and can be relocated safely. When copy is needed, observer is moved to shared storage once via `share()`.
+     */
+    template<rpp::constraint::decayed_type Type>
+    class unique_dynamic_strategy final
+    {
+        using storage         = rpp::utils::small_buffer<6 * sizeof(void*)>;
+        using shared_observer = std::shared_ptr<observer_vtable<Type>>;
+
+        struct vtable
+        {
+            void (*on_next_lvalue)(const storage&, const Type&){};
+            void (*on_next_rvalue)(const storage&, Type&&){};
+            void (*on_error)(const storage&, const std::exception_ptr&){};
+            void (*on_completed)(const storage&){};
+
+            void (*set_upstream)(storage&, const disposable_wrapper&){};
+            bool (*is_disposed)(const storage&){};
+
+            shared_observer (*share)(storage&){};
+            void (*relocate)(storage& from, storage& to) noexcept {};
+            void (*destroy)(storage&) noexcept {};
+
+            template<typename Holder>
+            static const vtable* create() noexcept
+            {
+                static const vtable s_res{
+                    .on_next_lvalue = +[](const storage& s, const Type& v) { Holder::get(s).on_next(v); },
+                    .on_next_rvalue = +[](const storage& s, Type&& v) { Holder::get(s).on_next(std::move(v)); },
+                    .on_error       = +[](const storage& s, const std::exception_ptr& err) { Holder::get(s).on_error(err); },
+                    .on_completed   = +[](const storage& s) { Holder::get(s).on_completed(); },
+                    .set_upstream   = +[](storage& s, const disposable_wrapper& d) { Holder::get(s).set_upstream(d); },
+                    .is_disposed    = +[](const storage& s) { return Holder::get(s).is_disposed(); },
+                    .share          = +[](storage& s) { return Holder::share(s); },
+                    .relocate       = +[](storage& from, storage& to) noexcept { from.template relocate_to<typename Holder::stored_type>(to); },
+                    .destroy        = +[](storage& s) noexcept { s.template destroy<typename Holder::stored_type>(); }};
+                return &s_res;
+            }
+        };
+
+        template<typename TObs>
+        struct inline_holder
+        {
+            using stored_type = TObs;
+
+            static const TObs& get(const storage& s) noexcept { return s.template get<TObs>(); }
+            static TObs&       get(storage& s) noexcept { return s.template get<TObs>(); }
+
+            static shared_observer share(storage& s) { return rpp::details::make_shared_state<type_erased_observer<TObs>>(std::move(get(s))); }
+        };
+
+        struct shared_holder
+        {
+            using stored_type = shared_observer;
+
+            static observer_vtable<Type>& get(const storage& s) noexcept { return *s.template get<shared_observer>(); }
+
+            static shared_observer share(storage& s) { return std::move(s.template get<shared_observer>()); }
+        };
+
+    public:
+        static constexpr auto preferred_disposables_mode = rpp::details::observers::disposables_mode::None;
+
+        template<rpp::constraint::observer_strategy<Type> Strategy>
+            requires (!rpp::constraint::decayed_same_as<Strategy, unique_dynamic_strategy<Type>>)
+        explicit unique_dynamic_strategy(observer<Type, Strategy>&& obs)
+        {
+            using TObs = observer<Type, Strategy>;
+
+            if constexpr (storage::template fits<TObs>)
+            {
+                m_storage.template emplace<TObs>(std::move(obs));
+                m_vtable = vtable::template create<inline_holder<TObs>>();
+            }
+            else
+            {
+                m_storage.template emplace<shared_observer>(rpp::details::make_shared_state<type_erased_observer<TObs>>(std::move(obs)));
+                m_vtable = vtable::template create<shared_holder>();
+            }
+        }
+
+        unique_dynamic_strategy(const unique_dynamic_strategy&) = delete;
+
+        unique_dynamic_strategy(unique_dynamic_strategy&& other) noexcept
+            : m_vtable{std::exchange(other.m_vtable, nullptr)}
+        {
+            if (m_vtable)
+                m_vtable->relocate(other.m_storage, m_storage);
+        }
+
+        unique_dynamic_strategy& operator=(const unique_dynamic_strategy&) = delete;
+
+        unique_dynamic_strategy& operator=(unique_dynamic_strategy&& other) noexcept
+        {
+            if (this != &other)
+            {
+                reset();
+                m_vtable = std::exchange(other.m_vtable, nullptr);
+                if (m_vtable)
+                    m_vtable->relocate(other.m_storage, m_storage);
+            }
+            return *this;
+        }
+
+        ~unique_dynamic_strategy() noexcept
+        {
+            reset();
+        }
+
+        void set_upstream(const disposable_wrapper& d) noexcept { m_vtable->set_upstream(m_storage, d); }
+        bool is_disposed() const noexcept { return m_vtable->is_disposed(m_storage); }
+
+        void on_next(const Type& v) const noexcept { m_vtable->on_next_lvalue(m_storage, v); }
+        void on_next(Type&& v) const noexcept { m_vtable->on_next_rvalue(m_storage, std::move(v)); }
+        void on_error(const std::exception_ptr& err) const noexcept { m_vtable->on_error(m_storage, err); }
+        void on_completed() const noexcept { m_vtable->on_completed(m_storage); }
+
+        shared_observer share() &&
+        {
+            auto res = m_vtable->share(m_storage);
+            reset();
+            return res;
+        }
+
+    private:
+        void reset() noexcept
+        {
+            if (const auto* v = std::exchange(m_vtable, nullptr))
+                v->destroy(m_storage);
+        }
+
+    private:
+        // observer is placed inline if it fits, `std::shared_ptr` to it otherwise
+        storage       m_storage{};
+        const vtable* m_vtable{};
+    };
+
     template<rpp::constraint::decayed_type Type>
     class dynamic_strategy final
     {
@@ -94,9 +234,15 @@ namespace rpp::details::observers
         static constexpr auto preferred_disposables_mode = rpp::details::observers::disposables_mode::None;
 
         template<rpp::constraint::observer_strategy<Type> Strategy>
-            requires (!rpp::constraint::decayed_same_as<Strategy, dynamic_strategy<Type>>)
+            requires (!rpp::constraint::decayed_same_as<Strategy, dynamic_strategy<Type>> && !rpp::constraint::decayed_same_as<Strategy, unique_dynamic_strategy<Type>>)
         explicit dynamic_strategy(observer<Type, Strategy>&& obs)
-            : m_observer{std::make_shared<type_erased_observer<observer<Type, Strategy>>>(std::move(obs))}
+            : m_observer{rpp::details::make_shared_state<type_erased_observer<observer<Type, Strategy>>>(std::move(obs))}
+        {
+        }
+
+        // copies of dynamic_observer share the same observer, so storage of unique owner is taken over instead of wrapping it once more
+        explicit dynamic_strategy(observer<Type, unique_dynamic_strategy<Type>>&& obs)
+            : m_observer{std::move(obs).share()}
         {
         }
 
@@ -118,7 +264,7 @@ namespace rpp
 {
     /**
      * @brief Type-erased version of the `rpp::observer`. Any observer can be converted to dynamic_observer via `rpp::observer::as_dynamic` member function.
-     * @details To provide type-erasure it uses `std::shared_ptr`. As a result it has worse performance, but it is **ONLY** way to copy observer.
+     * @details To provide type-erasure it uses `std::shared_ptr`, so all copies refer to the same observer. As a result it has worse performance, but it is **ONLY** way to copy observer. In case of copies are not needed, `rpp::dynamic_observable` passes observer via move-only erasure placing small observers inline instead.
      *
      * @tparam Type of value this observer can handle
      *
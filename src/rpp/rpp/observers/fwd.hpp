@@ -69,6 +69,9 @@ namespace rpp::details::observers
     template<rpp::constraint::decayed_type Type>
     class dynamic_strategy;
 
+    template<rpp::constraint::decayed_type Type>
+    class unique_dynamic_strategy;
+
     template<rpp::constraint::decayed_type             Type,
              std::invocable<Type>                      OnNext,
              std::invocable<const std::exception_ptr&> OnError,
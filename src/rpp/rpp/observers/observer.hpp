@@ -143,6 +143,9 @@ namespace rpp::details
             }
         }
 
+    protected:
+        Strategy& get_strategy() noexcept { return m_strategy; }
+
     private:
         RPP_NO_UNIQUE_ADDRESS Strategy                    m_strategy;
         RPP_NO_UNIQUE_ADDRESS mutable DisposablesStrategy m_disposable;
@@ -255,5 +258,39 @@ namespace rpp
         }
     };
 
+    /**
+     * @brief Move-only type-erased observer used internally (for example, by `rpp::dynamic_observable`). Small observers are placed inline without any heap allocation. Converted to `rpp::dynamic_observer` only when copy is really needed.
+     */
+    template<constraint::decayed_type Type>
+    class observer<Type, rpp::details::observers::unique_dynamic_strategy<Type>> final
+        : public details::observer_impl<Type, rpp::details::observers::unique_dynamic_strategy<Type>, details::observers::none_disposables_strategy>
+    {
+        using Base = details::observer_impl<Type, rpp::details::observers::unique_dynamic_strategy<Type>, details::observers::none_disposables_strategy>;
+
+    public:
+        template<constraint::observer_strategy<Type> TStrategy>
+            requires (!std::same_as<TStrategy, rpp::details::observers::unique_dynamic_strategy<Type>>)
+        explicit observer(observer<Type, TStrategy>&& other)
+            : Base{details::observers::none_disposables_strategy{}, std::move(other)}
+        {
+        }
+
+        observer(const observer&)     = delete;
+        observer(observer&&) noexcept = default;
+
+        dynamic_observer<Type> as_dynamic() &&
+        {
+            return dynamic_observer<Type>{std::move(*this)};
+        }
+
+        /**
+         * @brief Moves erased observer to shared storage, so it can be shared by copies of `rpp::dynamic_observer`
+         */
+        auto share() &&
+        {
+            return std::move(this->get_strategy()).share();
+        }
+    };
+
 
 } // namespace rpp
@@ -41,13 +41,13 @@ namespace rpp::operators::details
             : m_observer{std::move(observer)}
         {
             const auto d = disposable_wrapper_impl<refcount_disposable>::make();
-            m_disposable = d.lock();
+            m_disposable = rpp::details::lock_disposable(d);
             get_observer()->set_upstream(d);
         }
 
         rpp::utils::pointer_under_lock<TObserver>               get_observer() { return m_observer; }
         rpp::utils::pointer_under_lock<std::queue<TObservable>> get_queue() { return m_queue; }
-        const std::shared_ptr<refcount_disposable>&             get_disposable() const { return m_disposable; }
+        const rpp::disposable_ptr<refcount_disposable>&         get_disposable() const { return m_disposable; }
 
         std::atomic<ConcatStage>& stage() { return m_stage; }
 
@@ -102,7 +102,7 @@ namespace rpp::operators::details
         }
 
     private:
-        std::shared_ptr<refcount_disposable>                  m_disposable{};
+        rpp::disposable_ptr<refcount_disposable>              m_disposable{};
         rpp::utils::value_with_mutex<TObserver>               m_observer;
         rpp::utils::value_with_mutex<std::queue<TObservable>> m_queue;
         std::atomic<ConcatStage>                              m_stage{};
@@ -168,7 +168,7 @@ namespace rpp::operators::details
         static constexpr auto preferred_disposables_mode = rpp::details::observers::disposables_mode::None;
 
         concat_observer_strategy(TObserver&& observer)
-            : base{std::make_shared<concat_state_t<TObservable, TObserver>>(std::move(observer))}
+            : base{rpp::details::make_shared_state<concat_state_t<TObservable, TObserver>>(std::move(observer))}
         {
         }
 
@@ -23,7 +23,7 @@ namespace rpp::operators::details
     template<rpp::constraint::observer Observer, typename Worker>
     struct debounce_state_wrapper
     {
-        std::shared_ptr<debounce_state<Observer, Worker>> state{};
+        rpp::disposable_ptr<debounce_state<Observer, Worker>> state{};
 
         bool is_disposed() const { return state->is_disposed(); }
 
@@ -80,7 +80,7 @@ namespace rpp::operators::details
 
                     return std::nullopt;
                 },
-                debounce_state_wrapper<Observer, Worker>{this->wrapper_from_this().lock()});
+                debounce_state_wrapper<Observer, Worker>{rpp::details::lock_disposable(this->wrapper_from_this())});
         }
 
         std::variant<std::monostate, T, schedulers::time_point> extract_value_or_time()
@@ -112,7 +112,7 @@ namespace rpp::operators::details
     {
         static constexpr auto preferred_disposables_mode = rpp::details::observers::disposables_mode::None;
 
-        std::shared_ptr<debounce_state<Observer, Worker>> state{};
+        rpp::disposable_ptr<debounce_state<Observer, Worker>> state{};
 
         void set_upstream(const rpp::disposable_wrapper& d) const
         {
@@ -165,7 +165,7 @@ namespace rpp::operators::details
             using worker_t = rpp::schedulers::utils::get_worker_t<Scheduler>;
 
             auto d   = rpp::disposable_wrapper_impl<debounce_state<std::decay_t<Observer>, worker_t>>::make(std::forward<Observer>(observer), scheduler.create_worker(), duration);
-            auto ptr = d.lock();
+            auto ptr = rpp::details::lock_disposable(d);
             ptr->get_observer_under_lock()->set_upstream(d.as_weak());
             return rpp::observer<Type, debounce_observer_strategy<std::decay_t<Observer>, worker_t>>{std::move(ptr)};
         }
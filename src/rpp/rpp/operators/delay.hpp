@@ -15,6 +15,8 @@
 #include <rpp/defs.hpp>
 #include <rpp/operators/details/strategy.hpp>
 
+#include <deque>
+#include <memory_resource>
 #include <mutex>
 #include <queue>
 
@@ -50,9 +52,9 @@ namespace rpp::operators::details
         RPP_NO_UNIQUE_ADDRESS Worker   worker;
         rpp::schedulers::duration      delay;
 
-        std::mutex              mutex{};
-        std::queue<emission<T>> queue;
-        bool                    is_active{};
+        std::mutex                                              mutex{};
+        std::queue<emission<T>, std::pmr::deque<emission<T>>> queue{std::pmr::deque<emission<T>>(rpp::details::current_memory_resource())};
+        bool                                                    is_active{};
     };
 
     template<rpp::constraint::observer Observer, typename Worker>
@@ -117,7 +119,8 @@ namespace rpp::operators::details
             std::lock_guard lock{state->mutex};
             if constexpr (ClearOnError && rpp::constraint::decayed_same_as<std::exception_ptr, TT>)
             {
-                state->queue = std::queue<emission<rpp::utils::extract_observer_type_t<Observer>>>{};
+                // pmr allocator is not propagated on assignment, so queue keeps its memory resource
+                state->queue = {};
                 state->observer.on_error(std::forward<TT>(item));
                 return std::nullopt;
             }
@@ -183,7 +186,7 @@ namespace rpp::operators::details
         {
             using worker_t = rpp::schedulers::utils::get_worker_t<Scheduler>;
 
-            auto state = std::make_shared<delay_state<std::decay_t<Observer>, worker_t>>(std::forward<Observer>(observer), scheduler.create_worker(), duration);
+            auto state = rpp::details::make_shared_state<delay_state<std::decay_t<Observer>, worker_t>>(std::forward<Observer>(observer), scheduler.create_worker(), duration);
             return rpp::observer<Type, delay_observer_strategy<std::decay_t<Observer>, worker_t, ClearOnError>>{std::move(state)};
         }
     };
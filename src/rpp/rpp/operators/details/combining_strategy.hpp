@@ -51,7 +51,7 @@ namespace rpp::operators::details
     {
         static constexpr auto preferred_disposables_mode = rpp::details::observers::disposables_mode::Auto;
 
-        std::shared_ptr<TState> state{};
+        rpp::disposable_ptr<TState> state{};
 
         void set_upstream(const rpp::disposable_wrapper& d) const
         {
@@ -107,7 +107,7 @@ namespace rpp::operators::details
             using State = TState<Observer, TSelector, Type, rpp::utils::extract_observable_type_t<TObservables>...>;
 
             const auto d     = rpp::disposable_wrapper_impl<State>::make(std::forward<Observer>(observer), selector);
-            auto       state = d.lock();
+            auto       state = rpp::details::lock_disposable(d);
             state->get_observer_under_lock()->set_upstream(d.as_weak());
 
             subscribe<std::decay_t<Type>>(state, std::index_sequence_for<TObservables...>{}, observables...);
@@ -116,7 +116,7 @@ namespace rpp::operators::details
         }
 
         template<typename ExpectedValue, rpp::constraint::observer Observer, size_t... I>
-        static void subscribe(const std::shared_ptr<TState<Observer, TSelector, ExpectedValue, rpp::utils::extract_observable_type_t<TObservables>...>>& state, std::index_sequence<I...>, const TObservables&... observables)
+        static void subscribe(const rpp::disposable_ptr<TState<Observer, TSelector, ExpectedValue, rpp::utils::extract_observable_type_t<TObservables>...>>& state, std::index_sequence<I...>, const TObservables&... observables)
         {
             (..., observables.subscribe(rpp::observer<rpp::utils::extract_observable_type_t<TObservables>, TStrategy<I + 1, Observer, TSelector, ExpectedValue, rpp::utils::extract_observable_type_t<TObservables>...>>{state}));
         }
@@ -28,7 +28,7 @@ namespace rpp::operators::details
         {
             static constexpr auto preferred_disposables_mode = rpp::details::observers::disposables_mode::None;
 
-            std::shared_ptr<subjects::details::subject_state<Type, false>> state{};
+            rpp::disposable_ptr<subjects::details::subject_state<Type, false>> state{};
 
             void set_upstream(const disposable_wrapper& d) const noexcept { state->add(d); }
 
@@ -51,15 +51,15 @@ namespace rpp::operators::details
 
         auto get_observer() const
         {
-            return rpp::observer<Type, observer_strategy>{m_state.lock()};
+            return rpp::observer<Type, observer_strategy>{m_state};
         }
 
         auto get_observable() const
         {
-            return subjects::details::create_subject_on_subscribe_observable<Type, optimal_disposables_strategy>([state = m_state.as_weak(), refcount = m_refcount]<rpp::constraint::observer_of_type<Type> TObs>(TObs&& observer) {
-                if (const auto locked_state = state.lock())
+            return subjects::details::create_subject_on_subscribe_observable<Type, optimal_disposables_strategy>([state = m_state->wrapper_from_this().as_weak(), refcount = m_refcount]<rpp::constraint::observer_of_type<Type> TObs>(TObs&& observer) {
+                if (const auto locked_state = rpp::details::lock_disposable(state))
                 {
-                    if (const auto locked = refcount.lock())
+                    if (const auto locked = rpp::details::lock_disposable(refcount))
                         observer.set_upstream(locked->add_ref());
                     locked_state->on_subscribe(std::forward<TObs>(observer));
                 }
@@ -68,11 +68,11 @@ namespace rpp::operators::details
 
         rpp::composite_disposable_wrapper get_disposable() const
         {
-            return m_state.as_weak();
+            return m_state->wrapper_from_this().as_weak();
         }
 
     private:
-        disposable_wrapper_impl<rpp::refcount_disposable>                      m_refcount;
-        disposable_wrapper_impl<subjects::details::subject_state<Type, false>> m_state = disposable_wrapper_impl<subjects::details::subject_state<Type, false>>::make();
+        disposable_wrapper_impl<rpp::refcount_disposable>                  m_refcount;
+        rpp::disposable_ptr<subjects::details::subject_state<Type, false>> m_state = rpp::details::lock_disposable(disposable_wrapper_impl<subjects::details::subject_state<Type, false>>::make());
     };
 } // namespace rpp::operators::details
@@ -16,6 +16,7 @@
 #include <rpp/operators/details/strategy.hpp>
 #include <rpp/utils/constraints.hpp>
 
+#include <memory_resource>
 #include <unordered_set>
 
 namespace rpp::operators::details
@@ -25,8 +26,8 @@ namespace rpp::operators::details
     {
         static constexpr auto preferred_disposables_mode = rpp::details::observers::disposables_mode::None;
 
-        RPP_NO_UNIQUE_ADDRESS TObserver  observer;
-        mutable std::unordered_set<Type> past_values{};
+        RPP_NO_UNIQUE_ADDRESS TObserver        observer;
+        mutable std::pmr::unordered_set<Type> past_values = std::pmr::unordered_set<Type>(rpp::details::current_memory_resource());
 
         template<typename T>
         void on_next(T&& v) const
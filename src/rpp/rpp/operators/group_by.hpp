@@ -19,6 +19,7 @@
 #include <rpp/utils/function_traits.hpp>
 
 #include <map>
+#include <memory_resource>
 #include <type_traits>
 
 namespace rpp::operators::details
@@ -73,9 +74,9 @@ namespace rpp::operators::details
 
         using subject_observer = decltype(std::declval<subjects::publish_subject<Type>>().get_observer());
 
-        mutable std::map<TKey, subject_observer, KeyComparator> key_to_observer{};
-        std::shared_ptr<refcount_disposable>                    disposable = [&] {
-            auto ptr = disposable_wrapper_impl<refcount_disposable>::make().lock();
+        mutable std::pmr::map<TKey, subject_observer, KeyComparator> key_to_observer{comparator, rpp::details::current_memory_resource()};
+        rpp::disposable_ptr<refcount_disposable>                     disposable = [&] {
+            auto ptr = rpp::details::lock_disposable(disposable_wrapper_impl<refcount_disposable>::make());
             observer.set_upstream(ptr->add_ref());
             return ptr;
         }();
@@ -131,7 +132,7 @@ namespace rpp::operators::details
             disposable->add(subj.get_disposable().as_weak());
             obs.on_next(rpp::grouped_observable_group_by<TKey, Type>{
                 key,
-                group_by_observable_strategy<Type>{subj, disposable}});
+                group_by_observable_strategy<Type>{subj, disposable->wrapper_from_this().as_weak()}});
 
             return &key_to_observer.emplace(key, subj.get_observer()).first->second;
         }
@@ -143,13 +144,13 @@ namespace rpp::operators::details
         using value_type                   = T;
         using optimal_disposables_strategy = typename rpp::subjects::publish_subject<T>::optimal_disposables_strategy;
 
-        rpp::subjects::publish_subject<T>  subj;
-        std::weak_ptr<refcount_disposable> disposable;
+        rpp::subjects::publish_subject<T>            subj;
+        disposable_wrapper_impl<refcount_disposable> disposable;
 
         template<rpp::constraint::observer_strategy<T> Strategy>
         void subscribe(observer<T, Strategy>&& obs) const
         {
-            if (const auto locked = disposable.lock())
+            if (const auto locked = rpp::details::lock_disposable(disposable))
             {
                 auto d = locked->add_ref();
                 obs.set_upstream(d);
@@ -40,12 +40,12 @@ namespace rpp::operators::details
 
         rpp::utils::pointer_under_lock<TObserver> get_observer_under_lock() { return m_observer; }
 
-        const rpp::composite_disposable_wrapper& get_disposable() const { return m_disposable; }
+        const rpp::disposable_wrapper_impl<rpp::composite_disposable>& get_disposable() const { return m_disposable; }
 
     private:
-        rpp::utils::value_with_mutex<TObserver> m_observer{};
-        rpp::composite_disposable_wrapper       m_disposable = composite_disposable_wrapper::make();
-        std::atomic_size_t                      m_on_completed_needed{1};
+        rpp::utils::value_with_mutex<TObserver>                 m_observer{};
+        rpp::disposable_wrapper_impl<rpp::composite_disposable> m_disposable = rpp::disposable_wrapper_impl<rpp::composite_disposable>::make();
+        std::atomic_size_t                                      m_on_completed_needed{1};
     };
 
     template<rpp::constraint::observer TObserver>
@@ -65,8 +65,8 @@ namespace rpp::operators::details
 
         void set_upstream(const rpp::disposable_wrapper& d) const
         {
-            m_state->get_disposable().add(d);
-            m_disposables.push_back(d);
+            if (const auto locked = rpp::details::lock_disposable(m_state->get_disposable()))
+                m_disposables.push_back(locked->add_with_handle(d));
         }
 
         bool is_disposed() const
@@ -87,16 +87,17 @@ namespace rpp::operators::details
             }
             else
             {
-                for (const auto& v : m_disposables)
+                if (const auto locked = rpp::details::lock_disposable(m_state->get_disposable()))
                 {
-                    m_state->get_disposable().remove(v);
+                    for (const auto& handle : m_disposables)
+                        locked->remove(handle);
                 }
             }
         }
 
     protected:
-        std::shared_ptr<merge_state<TObserver>>      m_state;
-        mutable std::vector<rpp::disposable_wrapper> m_disposables{};
+        std::shared_ptr<merge_state<TObserver>>                           m_state;
+        mutable std::vector<rpp::details::disposables::disposable_handle> m_disposables{};
     };
 
     template<rpp::constraint::observer TObserver>
@@ -116,7 +117,7 @@ namespace rpp::operators::details
     {
     public:
         explicit merge_observer_strategy(TObserver&& observer)
-            : merge_observer_base_strategy<TObserver>{std::make_shared<merge_state<TObserver>>(std::move(observer))}
+            : merge_observer_base_strategy<TObserver>{rpp::details::make_shared_state<merge_state<TObserver>>(std::move(observer))}
         {
         }
 
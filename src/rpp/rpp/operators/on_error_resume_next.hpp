@@ -52,7 +52,7 @@ namespace rpp::operators::details
         static constexpr auto preferred_disposables_mode = rpp::details::observers::disposables_mode::None;
 
         on_error_resume_next_observer_strategy(TObserver&& observer, const Selector& selector)
-            : state{std::make_shared<TObserver>(std::move(observer))}
+            : state{rpp::details::make_shared_state<TObserver>(std::move(observer))}
             , selector{selector}
         {
         }
@@ -48,7 +48,7 @@ namespace rpp::operators::details
     public:
         static constexpr auto preferred_disposables_mode = rpp::details::observers::disposables_mode::None;
 
-        switch_on_next_inner_observer_strategy(const std::shared_ptr<switch_on_next_state_t<TObserver>>& state, const composite_disposable_wrapper& refcounted)
+        switch_on_next_inner_observer_strategy(const rpp::disposable_ptr<switch_on_next_state_t<TObserver>>& state, const composite_disposable_wrapper& refcounted)
             : m_state{state}
             , m_refcounted{refcounted}
         {
@@ -77,7 +77,7 @@ namespace rpp::operators::details
         bool is_disposed() const { return m_refcounted.is_disposed(); }
 
     private:
-        std::shared_ptr<switch_on_next_state_t<TObserver>> m_state;
+        rpp::disposable_ptr<switch_on_next_state_t<TObserver>> m_state;
         rpp::composite_disposable_wrapper                  m_refcounted;
     };
 
@@ -119,16 +119,16 @@ namespace rpp::operators::details
         bool is_disposed() const { return m_this_refcount.is_disposed(); }
 
     private:
-        static std::shared_ptr<switch_on_next_state_t<TObserver>> init_state(TObserver&& observer)
+        static rpp::disposable_ptr<switch_on_next_state_t<TObserver>> init_state(TObserver&& observer)
         {
             const auto d   = disposable_wrapper_impl<switch_on_next_state_t<TObserver>>::make(std::move(observer));
-            auto       ptr = d.lock();
+            auto       ptr = rpp::details::lock_disposable(d);
             ptr->get_observer()->set_upstream(d.as_weak());
             return ptr;
         }
 
     private:
-        std::shared_ptr<switch_on_next_state_t<TObserver>> m_state;
+        rpp::disposable_ptr<switch_on_next_state_t<TObserver>> m_state;
         rpp::composite_disposable_wrapper                  m_this_refcount = m_state->add_ref();
         mutable rpp::composite_disposable_wrapper          m_last_refcount = composite_disposable_wrapper::empty();
     };
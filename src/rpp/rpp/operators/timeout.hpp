@@ -51,7 +51,7 @@ namespace rpp::operators::details
     template<rpp::constraint::observer TObserver, rpp::constraint::observable TFallbackObservable, rpp::details::disposables::constraint::disposables_container Container>
     struct timeout_disposable_wrapper
     {
-        std::shared_ptr<timeout_disposable<TObserver, TFallbackObservable, Container>> disposable;
+        rpp::disposable_ptr<timeout_disposable<TObserver, TFallbackObservable, Container>> disposable;
 
         bool is_disposed() const { return disposable->is_disposed(); }
 
@@ -66,7 +66,7 @@ namespace rpp::operators::details
     {
         static constexpr auto preferred_disposables_mode = rpp::details::observers::disposables_mode::None;
 
-        std::shared_ptr<timeout_disposable<TObserver, TFallbackObservable, Container>> disposable;
+        rpp::disposable_ptr<timeout_disposable<TObserver, TFallbackObservable, Container>> disposable;
 
         void set_upstream(const rpp::disposable_wrapper& d) const
         {
@@ -130,7 +130,7 @@ namespace rpp::operators::details
             const auto timeout = worker_t::now() + period;
 
             const auto disposable = disposable_wrapper_impl<timeout_disposable<std::decay_t<Observer>, TFallbackObservable, container>>::make(std::forward<Observer>(observer), period, fallback, timeout);
-            auto       ptr        = disposable.lock();
+            auto       ptr        = rpp::details::lock_disposable(disposable);
             ptr->get_observer_with_timeout_under_lock()->observer.set_upstream(disposable.as_weak());
 
             const auto worker = scheduler.create_worker();
@@ -52,8 +52,7 @@ namespace rpp::operators::details
             if (m_items_in_current_window == m_window_size)
             {
                 Subject subject{m_disposable->wrapper_from_this()};
-                m_subject_data.emplace(subject.get_observer(), subject.get_disposable());
-                m_disposable->add(m_subject_data->disposable);
+                m_subject_data.emplace(subject.get_observer(), m_disposable->add_with_handle(subject.get_disposable()));
                 m_observer.on_next(subject.get_observable());
                 m_items_in_current_window = 0;
             }
@@ -64,7 +63,7 @@ namespace rpp::operators::details
             if (++m_items_in_current_window == m_window_size)
             {
                 m_subject_data->observer.on_completed();
-                m_disposable->remove(m_subject_data->disposable);
+                m_disposable->remove(m_subject_data->handle);
                 m_subject_data.reset();
             }
         }
@@ -88,21 +87,21 @@ namespace rpp::operators::details
         bool is_disposed() const { return m_disposable->is_disposed(); }
 
     private:
-        std::shared_ptr<refcount_disposable> m_disposable = disposable_wrapper_impl<refcount_disposable>::make().lock();
-        RPP_NO_UNIQUE_ADDRESS TObserver      m_observer;
+        rpp::disposable_ptr<refcount_disposable> m_disposable = rpp::details::lock_disposable(disposable_wrapper_impl<refcount_disposable>::make());
+        RPP_NO_UNIQUE_ADDRESS TObserver          m_observer;
 
         struct subject_data
         {
             using TObs = decltype(std::declval<Subject>().get_observer());
 
-            subject_data(TObs&& obs, rpp::disposable_wrapper&& d)
+            subject_data(TObs&& obs, const rpp::details::disposables::disposable_handle& handle)
                 : observer{std::move(obs)}
-                , disposable{std::move(d)}
+                , handle{handle}
             {
             }
 
-            TObs                    observer;
-            rpp::disposable_wrapper disposable;
+            TObs                                         observer;
+            rpp::details::disposables::disposable_handle handle;
         };
 
         mutable std::optional<subject_data> m_subject_data;
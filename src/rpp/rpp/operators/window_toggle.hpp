@@ -76,9 +76,10 @@ namespace rpp::operators::details
     {
         static constexpr auto preferred_disposables_mode = rpp::details::observers::disposables_mode::None;
 
-        std::shared_ptr<rpp::refcount_disposable>                                                 disposable;
+        rpp::disposable_ptr<rpp::refcount_disposable>                                             disposable;
         std::shared_ptr<TState>                                                                   state;
         rpp::composite_disposable_wrapper                                                         this_disposable;
+        rpp::details::disposables::disposable_handle                                              handle;
         decltype(std::declval<TState>().on_new_subject(std::declval<typename TState::Subject>())) itr;
 
         void on_next(const auto&) const
@@ -96,7 +97,7 @@ namespace rpp::operators::details
 
         void on_completed() const
         {
-            disposable->remove(this_disposable);
+            disposable->remove(handle);
 
             itr->on_completed();
             this_disposable.dispose();
@@ -114,8 +115,8 @@ namespace rpp::operators::details
     {
         static constexpr auto preferred_disposables_mode = rpp::details::observers::disposables_mode::Auto;
 
-        std::shared_ptr<rpp::refcount_disposable> disposable;
-        std::shared_ptr<TState>                   state;
+        rpp::disposable_ptr<rpp::refcount_disposable> disposable;
+        std::shared_ptr<TState>                       state;
 
         template<typename T>
         void on_next(T&& v) const
@@ -123,8 +124,8 @@ namespace rpp::operators::details
             typename TState::Subject subject{disposable->wrapper_from_this()};
             const auto               itr = state->on_new_subject(subject);
 
-            disposable->add(subject.get_disposable());
-            state->get_closing(std::forward<T>(v)).subscribe(window_toggle_closing_observer_strategy<TState>{disposable, state, subject.get_disposable(), itr});
+            const auto handle = disposable->add_with_handle(subject.get_disposable());
+            state->get_closing(std::forward<T>(v)).subscribe(window_toggle_closing_observer_strategy<TState>{disposable, state, subject.get_disposable(), handle, itr});
         }
 
         void on_error(const std::exception_ptr& err) const
@@ -150,7 +151,7 @@ namespace rpp::operators::details
         static constexpr auto preferred_disposables_mode = rpp::details::observers::disposables_mode::None;
 
         window_toggle_observer_strategy(TObserver&& observer, const TOpeningsObservable& openings, const TClosingsSelectorFn& closings)
-            : m_state{std::make_shared<TState>(std::move(observer), closings)}
+            : m_state{rpp::details::make_shared_state<TState>(std::move(observer), closings)}
         {
             m_state->get_state_under_lock()->observer.set_upstream(m_disposable->add_ref());
             m_disposable->add(openings.subscribe_with_disposable(window_toggle_opening_observer_strategy<TState>{m_disposable, m_state}));
@@ -184,8 +185,8 @@ namespace rpp::operators::details
         bool is_disposed() const { return m_disposable->is_disposed(); }
 
     private:
-        std::shared_ptr<rpp::refcount_disposable> m_disposable = disposable_wrapper_impl<rpp::refcount_disposable>::make().lock();
-        std::shared_ptr<TState>                   m_state;
+        rpp::disposable_ptr<rpp::refcount_disposable> m_disposable = rpp::details::lock_disposable(disposable_wrapper_impl<rpp::refcount_disposable>::make());
+        std::shared_ptr<TState>                       m_state;
     };
 
     template<rpp::constraint::observable TOpeningsObservable, typename TClosingsSelectorFn>
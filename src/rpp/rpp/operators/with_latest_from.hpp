@@ -156,7 +156,7 @@ namespace rpp::operators::details
         {
             using State = with_latest_from_state<Observer, TSelector, rpp::utils::extract_observable_type_t<TObservables>...>;
 
-            auto ptr = std::make_shared<State>(std::forward<Observer>(observer), selector);
+            auto ptr = rpp::details::make_shared_state<State>(std::forward<Observer>(observer), selector);
             subscribe(ptr, std::index_sequence_for<TObservables...>{}, observables...);
 
             return rpp::observer<Type, with_latest_from_observer_strategy<std::decay_t<Observer>, TSelector, Type, rpp::utils::extract_observable_type_t<TObservables>...>>{std::move(ptr)};
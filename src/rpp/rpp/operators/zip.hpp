@@ -17,6 +17,7 @@
 #include <rpp/operators/details/strategy.hpp>
 
 #include <deque>
+#include <memory_resource>
 
 namespace rpp::operators::details
 {
@@ -26,6 +27,7 @@ namespace rpp::operators::details
     public:
         explicit zip_state(Observer&& observer, const TSelector& selector)
             : combining_state<Observer>(std::move(observer), sizeof...(Args))
+            , m_pendings{std::pmr::deque<Args>(rpp::details::current_memory_resource())...}
             , m_selector(selector)
         {
         }
@@ -35,7 +37,7 @@ namespace rpp::operators::details
         auto& get_pendings() { return m_pendings; }
 
     private:
-        utils::tuple<std::deque<Args>...> m_pendings{};
+        utils::tuple<std::pmr::deque<Args>...> m_pendings;
 
         RPP_NO_UNIQUE_ADDRESS TSelector m_selector;
     };
@@ -57,7 +59,7 @@ namespace rpp::operators::details
 
     private:
         template<typename TDisposable>
-        static void apply_impl(const TDisposable& disposable, const rpp::utils::pointer_under_lock<Observer>& observer, std::deque<Args>&... values)
+        static void apply_impl(const TDisposable& disposable, const rpp::utils::pointer_under_lock<Observer>& observer, std::pmr::deque<Args>&... values)
         {
             if ((!values.empty() && ...))
             {
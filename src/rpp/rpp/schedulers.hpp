@@ -19,7 +19,12 @@
 
 #include <rpp/schedulers/computational.hpp>
 #include <rpp/schedulers/current_thread.hpp>
+#include <rpp/schedulers/edf_thread.hpp>
 #include <rpp/schedulers/immediate.hpp>
+#include <rpp/schedulers/instrumentation.hpp>
+#include <rpp/schedulers/io.hpp>
 #include <rpp/schedulers/new_thread.hpp>
 #include <rpp/schedulers/run_loop.hpp>
+#include <rpp/schedulers/simulation_scheduler.hpp>
+#include <rpp/schedulers/strand.hpp>
 #include <rpp/schedulers/thread_pool.hpp>
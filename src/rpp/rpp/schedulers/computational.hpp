@@ -14,12 +14,17 @@
 
 #include <rpp/schedulers/thread_pool.hpp>
 
+#include <mutex>
+#include <stdexcept>
+
 namespace rpp::schedulers
 {
     /**
      * @brief Scheduler owning static thread pool of workers and using "some" thread from this pool on `create_worker` call
      * @warning Actually it is static variable to `thread_pool` scheduler
      * @note Expected to pass to this scheduler intensive CPU bound tasks with relatevely small duration of execution (to be sure that no any thread with tasks from some other operators would be blocked on that task)
+     * @note Underlying pool can be switched to `thread_pool::mode::work_stealing` via `computational::configure` to avoid blocking of other workers by some long-running task.
+     * @note Placement of threads (affinity, NUMA nodes, names) can be configured via `computational::configure` with `thread_pool::options`.
      *
      * @par Examples
      * @snippet thread_pool.cpp computational
@@ -29,10 +34,55 @@ namespace rpp::schedulers
     class computational final
     {
     public:
+        /**
+         * @brief Configures underlying static `thread_pool`.
+         * @throws std::logic_error in case of underlying `thread_pool` is already created by first `create_worker` call
+         */
+        static void configure(size_t threads_count, thread_pool::mode mode = thread_pool::mode::pinned)
+        {
+            configure(thread_pool::options{threads_count, mode});
+        }
+
+        /**
+         * @brief Configures underlying static `thread_pool` with full set of options: threads count, mode, affinity and names of threads.
+         * @throws std::logic_error in case of underlying `thread_pool` is already created by first `create_worker` call
+         */
+        static void configure(const thread_pool::options& options)
+        {
+            auto&           config = get_config();
+            std::lock_guard lock{config.mutex};
+            if (config.is_used)
+                throw std::logic_error{"computational::configure is called after creation of underlying thread_pool"};
+
+            config.options = options;
+        }
+
         static auto create_worker()
         {
-            static thread_pool s_tp{};
+            static thread_pool s_tp{take_options()};
             return s_tp.create_worker();
         }
+
+    private:
+        struct config
+        {
+            std::mutex           mutex{};
+            thread_pool::options options{};
+            bool                 is_used{};
+        };
+
+        static config& get_config()
+        {
+            static config s_config{};
+            return s_config;
+        }
+
+        static thread_pool::options take_options()
+        {
+            auto&           config = get_config();
+            std::lock_guard lock{config.mutex};
+            config.is_used = true;
+            return config.options;
+        }
     };
 } // namespace rpp::schedulers
@@ -104,17 +104,29 @@ namespace rpp::schedulers
 
         static void drain_queue() noexcept
         {
+            // slack and priority of caller should not leak to nested schedulings
+            const details::timer_slack_scope reset_slack{duration::min()};
+            const details::priority_scope    reset_priority{priority::normal};
+
             while (get_queue() && !get_queue()->is_empty())
             {
-                auto top = get_queue()->pop();
+                details::instrumentation::on_queue_depth(instrumentation::scheduler_kind::current_thread, get_queue()->size());
+                const bool is_ready = get_queue()->is_top_ready();
+                auto       top      = get_queue()->pop();
                 if (top->is_disposed())
+                {
+                    details::instrumentation::on_disposed_skipped(instrumentation::scheduler_kind::current_thread);
                     continue;
+                }
 
-                details::sleep_until(top->get_timepoint());
+                if (!is_ready)
+                    details::sleep_until(top->get_timepoint());
 
+                auto expected = std::optional{top->get_timepoint()};
                 while (true)
                 {
-                    if (const auto res = top->make_advanced_call())
+                    // each execution is recorded separately without sleeping between them
+                    if (const auto res = details::instrumentation::record_execution(instrumentation::scheduler_kind::current_thread, std::exchange(expected, std::nullopt), [&] { return top->make_advanced_call(); }))
                     {
                         if (!top->is_disposed())
                         {
@@ -122,11 +134,12 @@ namespace rpp::schedulers
                             {
                                 if (const auto d = std::get_if<delay_from_now>(&res->get()))
                                 {
-                                    std::this_thread::sleep_for(d->value);
+                                    details::sleep_for(d->value);
                                 }
                                 else
                                 {
-                                    details::sleep_until(top->handle_advanced_call(res.value()));
+                                    expected = top->handle_advanced_call(res.value());
+                                    details::sleep_until(expected.value());
                                 }
                                 continue;
                             }
@@ -182,6 +195,9 @@ namespace rpp::schedulers
                 }
             }
 
+            static constexpr bool is_queue_based = true;
+            static constexpr bool is_real_clock  = true;
+
             static rpp::schedulers::time_point now() { return details::now(); }
         };
 
@@ -189,8 +205,9 @@ namespace rpp::schedulers
         class own_queue_guard
         {
         public:
-            own_queue_guard()
-                : m_clear_on_destruction{!get_queue()}
+            explicit own_queue_guard(queue_backend backend)
+                : m_queue{backend}
+                , m_clear_on_destruction{!get_queue()}
             {
                 if (m_clear_on_destruction)
                     get_queue() = &m_queue;
@@ -209,9 +226,13 @@ namespace rpp::schedulers
         };
 
     public:
-        static own_queue_guard own_queue_and_drain_finally_if_not_owned()
+        /**
+         * @brief Makes current thread owner of the queue (if not owned yet) and drains this queue during destruction of returned guard.
+         * @param backend storage of the queue of schedulables if queue would be created. Use `queue_backend::heap` in case of expected huge amount of pending timers.
+         */
+        static own_queue_guard own_queue_and_drain_finally_if_not_owned(queue_backend backend = queue_backend::linked_list)
         {
-            return own_queue_guard{};
+            return own_queue_guard{backend};
         }
 
         static rpp::schedulers::worker<worker_strategy> create_worker()
@@ -0,0 +1,391 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/schedulers/fwd.hpp>
+
+#if defined(__linux__)
+
+    #include <rpp/disposables/details/base_disposable.hpp>
+    #include <rpp/schedulers/current_thread.hpp>
+    #include <rpp/schedulers/details/queue.hpp>
+    #include <rpp/schedulers/instrumentation.hpp>
+    #include <rpp/utils/utils.hpp>
+
+    #include <sys/epoll.h>
+    #include <sys/eventfd.h>
+    #include <sys/timerfd.h>
+    #include <unistd.h>
+
+    #include <array>
+    #include <atomic>
+    #include <cerrno>
+    #include <cstdint>
+    #include <memory>
+    #include <system_error>
+    #include <unordered_map>
+    #include <vector>
+
+namespace rpp::schedulers
+{
+    /**
+     * @brief Readiness events of file descriptor observed via `epoll_loop::observe_fd`
+     */
+    enum class fd_events : uint8_t
+    {
+        none     = 0,
+        readable = 1 << 0,
+        writable = 1 << 1,
+        error    = 1 << 2, // always reported, can't be masked
+        hangup   = 1 << 3  // always reported, can't be masked
+    };
+
+    constexpr fd_events operator|(fd_events lhs, fd_events rhs) { return static_cast<fd_events>(static_cast<uint8_t>(lhs) | static_cast<uint8_t>(rhs)); }
+    constexpr fd_events operator&(fd_events lhs, fd_events rhs) { return static_cast<fd_events>(static_cast<uint8_t>(lhs) & static_cast<uint8_t>(rhs)); }
+} // namespace rpp::schedulers
+
+namespace rpp::schedulers::details
+{
+    class epoll_reactor;
+
+    /**
+     * @brief Subscription to readiness events of some file descriptor. Owned by `epoll_reactor` while registered.
+     */
+    class epoll_fd_watch : public rpp::details::base_disposable
+    {
+    public:
+        epoll_fd_watch(std::weak_ptr<epoll_reactor> reactor, int fd, fd_events events)
+            : m_reactor{std::move(reactor)}
+            , m_fd{fd}
+            , m_events{events}
+        {
+        }
+
+        int       get_fd() const { return m_fd; }
+        fd_events get_events() const { return m_events; }
+
+        virtual void on_events(fd_events events) noexcept             = 0;
+        virtual void on_error(const std::exception_ptr& err) noexcept = 0;
+
+    protected:
+        void base_dispose_impl(interface_disposable::Mode mode) noexcept override;
+
+    private:
+        std::weak_ptr<epoll_reactor> m_reactor;
+        int                          m_fd;
+        fd_events                    m_events;
+    };
+
+    /**
+     * @brief Single-threaded reactor multiplexing schedulables and file descriptors via epoll.
+     * @details All timers are multiplexed through single `timerfd` armed to wake-up time_point of the earliest schedulable (its time_point plus timer slack, see `timer_slack`). Thread dispatching reactor is woken up via `eventfd` only in case of it is blocked inside `epoll_wait` and some other thread submitted new schedulable.
+     * Schedulables and callbacks of file descriptors are executed only by thread calling `dispatch`. During dispatching this thread owns queue of reactor as `current_thread` queue, so `current_thread` schedulings are trampolined into the same queue.
+     */
+    class epoll_reactor final
+    {
+        // amount of schedulables executed per one dispatch to avoid starvation of file descriptors by recursive schedulables
+        static constexpr size_t s_max_batch_size = 64;
+        static constexpr size_t s_max_events     = 64;
+
+        struct control_handler
+        {
+            static bool is_disposed() noexcept { return false; }
+            static void on_error(const std::exception_ptr&) noexcept {}
+        };
+
+    public:
+        explicit epoll_reactor(duration timer_slack = {})
+            : m_epoll_fd{check(::epoll_create1(EPOLL_CLOEXEC), "epoll_create1")}
+            , m_event_fd{check(::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK), "eventfd")}
+            , m_timer_fd{check(::timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC | TFD_NONBLOCK), "timerfd_create")}
+            , m_timer_slack{timer_slack}
+        {
+            epoll_event event{};
+            event.events  = EPOLLIN;
+            event.data.fd = m_event_fd;
+            check(::epoll_ctl(m_epoll_fd, EPOLL_CTL_ADD, m_event_fd, &event), "epoll_ctl");
+            event.data.fd = m_timer_fd;
+            check(::epoll_ctl(m_epoll_fd, EPOLL_CTL_ADD, m_timer_fd, &event), "epoll_ctl");
+        }
+
+        epoll_reactor(const epoll_reactor&) = delete;
+        epoll_reactor(epoll_reactor&&)      = delete;
+
+        ~epoll_reactor() noexcept
+        {
+            m_watches.clear();
+            m_queue = schedulables_queue<current_thread::worker_strategy>{};
+            m_inbox.clear();
+
+            ::close(m_timer_fd);
+            ::close(m_event_fd);
+            ::close(m_epoll_fd);
+        }
+
+        template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
+        void defer_to(time_point time_point, Fn&& fn, Handler&& handler, Args&&... args)
+        {
+            // schedule from the dispatching thread itself: queue is owned by this thread, so no any synchronization needed
+            if (current_thread::get_queue() == &m_queue)
+            {
+                m_queue.emplace(time_point, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+                return;
+            }
+
+            m_inbox.emplace(time_point, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+            // dispatching thread checks inbox after raising this flag, so notification is not lost
+            if (m_is_parked.load())
+                wake_up();
+        }
+
+        void watch(std::shared_ptr<epoll_fd_watch> watch)
+        {
+            post([this, watch = std::move(watch)] {
+                if (watch->is_disposed())
+                    return;
+
+                auto& watches = m_watches[watch->get_fd()];
+                watches.push_back(watch);
+                if (const auto err = update_fd(watch->get_fd()))
+                {
+                    watches.pop_back();
+                    if (watches.empty())
+                        m_watches.erase(watch->get_fd());
+                    watch->on_error(std::make_exception_ptr(std::system_error{err, std::system_category(), "epoll_ctl"}));
+                }
+            });
+        }
+
+        void unwatch(const epoll_fd_watch* watch)
+        {
+            post([this, watch, fd = watch->get_fd()] {
+                const auto it = m_watches.find(fd);
+                if (it == m_watches.end())
+                    return;
+
+                std::erase_if(it->second, [&](const auto& w) { return w.get() == watch; });
+                update_fd(fd);
+            });
+        }
+
+        void stop()
+        {
+            m_is_stopping.store(true);
+            wake_up();
+        }
+
+        void run()
+        {
+            while (!m_is_stopping.load())
+                dispatch(true);
+            m_is_stopping.store(false);
+        }
+
+        /**
+         * @brief Processes ready file descriptors and due schedulables. In case of `wait` blocks till something becomes ready.
+         */
+        void dispatch(bool wait)
+        {
+            auto&                            queue    = current_thread::get_queue();
+            const auto                       previous = std::exchange(queue, &m_queue);
+            const rpp::utils::finally_action _{[&] { queue = previous; }};
+
+            m_inbox.splice_to(m_queue);
+
+            int timeout = 0;
+            if (wait && !has_due_schedulable())
+            {
+                arm_timer();
+                m_is_parked.store(true);
+                if (m_inbox.is_empty() && !m_is_stopping.load())
+                    timeout = -1;
+            }
+
+            std::array<epoll_event, s_max_events> events{};
+            const int                             count = ::epoll_wait(m_epoll_fd, events.data(), static_cast<int>(events.size()), timeout);
+            m_is_parked.store(false);
+
+            for (int i = 0; i < count; ++i)
+                handle_event(events[static_cast<size_t>(i)]);
+
+            m_inbox.splice_to(m_queue);
+            execute_due_schedulables();
+        }
+
+        bool is_empty() const { return m_queue.is_empty() && m_inbox.is_empty(); }
+
+    private:
+        static int check(int res, const char* what)
+        {
+            if (res < 0)
+                throw std::system_error{errno, std::system_category(), what};
+            return res;
+        }
+
+        template<typename Fn>
+        void post(Fn&& fn)
+        {
+            defer_to(
+                current_thread::worker_strategy::now(),
+                [fn = std::forward<Fn>(fn)](const control_handler&) -> optional_delay_from_now {
+                    fn();
+                    return std::nullopt;
+                },
+                control_handler{});
+        }
+
+        void wake_up() const
+        {
+            const uint64_t              value = 1;
+            [[maybe_unused]] const auto res   = ::write(m_event_fd, &value, sizeof(value));
+        }
+
+        void drain_fd(int fd) const
+        {
+            uint64_t                    value{};
+            [[maybe_unused]] const auto res = ::read(fd, &value, sizeof(value));
+        }
+
+        // returns errno in case of failure
+        int update_fd(int fd)
+        {
+            const auto it = m_watches.find(fd);
+            if (it == m_watches.end())
+                return 0;
+
+            if (it->second.empty())
+            {
+                m_watches.erase(it);
+                // fd could be already closed by user
+                ::epoll_ctl(m_epoll_fd, EPOLL_CTL_DEL, fd, nullptr);
+                return 0;
+            }
+
+            epoll_event event{};
+            event.data.fd = fd;
+            for (const auto& watch : it->second)
+            {
+                // EPOLLRDHUP reports half-closed connection of peer as `fd_events::hangup`
+                if ((watch->get_events() & fd_events::readable) != fd_events::none)
+                    event.events |= EPOLLIN | EPOLLRDHUP;
+                if ((watch->get_events() & fd_events::writable) != fd_events::none)
+                    event.events |= EPOLLOUT;
+            }
+
+            if (::epoll_ctl(m_epoll_fd, EPOLL_CTL_MOD, fd, &event) == 0)
+                return 0;
+            if (errno == ENOENT && ::epoll_ctl(m_epoll_fd, EPOLL_CTL_ADD, fd, &event) == 0)
+                return 0;
+            return errno;
+        }
+
+        void handle_event(const epoll_event& event)
+        {
+            if (event.data.fd == m_event_fd || event.data.fd == m_timer_fd)
+            {
+                drain_fd(event.data.fd);
+                return;
+            }
+
+            const auto it = m_watches.find(event.data.fd);
+            if (it == m_watches.end())
+                return;
+
+            fd_events events{};
+            if (event.events & EPOLLIN)
+                events = events | fd_events::readable;
+            if (event.events & EPOLLOUT)
+                events = events | fd_events::writable;
+            if (event.events & EPOLLERR)
+                events = events | fd_events::error;
+            if (event.events & (EPOLLHUP | EPOLLRDHUP))
+                events = events | fd_events::hangup;
+
+            // callbacks never modify registry directly: all modifications are posted to the queue
+            for (const auto& watch : it->second)
+            {
+                const auto filtered = events & (watch->get_events() | fd_events::error | fd_events::hangup);
+                if (filtered != fd_events::none && !watch->is_disposed())
+                    watch->on_events(filtered);
+            }
+        }
+
+        bool has_due_schedulable() const
+        {
+            return !m_queue.is_empty() && (m_queue.is_top_ready() || m_queue.top()->is_disposed() || m_queue.top()->get_timepoint() <= current_thread::worker_strategy::now());
+        }
+
+        void arm_timer()
+        {
+            if (m_queue.is_empty())
+                return;
+
+            const auto wakeup_tp = m_queue.get_wakeup_timepoint(m_timer_slack);
+            if (wakeup_tp == m_armed_timepoint)
+                return;
+
+            m_armed_timepoint = wakeup_tp;
+
+            // steady_clock is CLOCK_MONOTONIC on linux. Zero value disarms timer, so use smallest non-zero one for already expired time_points
+            const auto ns = std::max(std::chrono::nanoseconds{1}, std::chrono::duration_cast<std::chrono::nanoseconds>(m_armed_timepoint.time_since_epoch()));
+
+            itimerspec spec{};
+            spec.it_value.tv_sec  = static_cast<time_t>(ns.count() / 1'000'000'000);
+            spec.it_value.tv_nsec = static_cast<long>(ns.count() % 1'000'000'000);
+            ::timerfd_settime(m_timer_fd, TFD_TIMER_ABSTIME, &spec, nullptr);
+        }
+
+        void execute_due_schedulables()
+        {
+            instrumentation::on_queue_depth(instrumentation::scheduler_kind::epoll_loop, m_queue.size());
+            for (size_t i = 0; i < s_max_batch_size && has_due_schedulable(); ++i)
+            {
+                auto top = m_queue.pop();
+                if (top->is_disposed())
+                {
+                    instrumentation::on_disposed_skipped(instrumentation::scheduler_kind::epoll_loop);
+                    continue;
+                }
+
+                const instrumentation::execution_scope _{instrumentation::scheduler_kind::epoll_loop, top->get_timepoint()};
+                if (const auto timepoint = (*top)())
+                    m_queue.emplace(timepoint.value(), std::move(top));
+            }
+        }
+
+    private:
+        const int      m_epoll_fd;
+        const int      m_event_fd;
+        const int      m_timer_fd;
+        const duration m_timer_slack;
+
+        // accessed only by dispatching thread
+        schedulables_queue<current_thread::worker_strategy>                   m_queue{};
+        std::unordered_map<int, std::vector<std::shared_ptr<epoll_fd_watch>>> m_watches{};
+        time_point                                                            m_armed_timepoint{};
+
+        schedulables_inbox<current_thread::worker_strategy> m_inbox{};
+        std::atomic_bool                                    m_is_parked{};
+        std::atomic_bool                                    m_is_stopping{};
+    };
+
+    inline void epoll_fd_watch::base_dispose_impl(interface_disposable::Mode mode) noexcept
+    {
+        // during destruction watch is already removed from reactor
+        if (mode == interface_disposable::Mode::Destroying)
+            return;
+
+        if (const auto reactor = m_reactor.lock())
+            reactor->unwatch(this);
+    }
+} // namespace rpp::schedulers::details
+
+#endif
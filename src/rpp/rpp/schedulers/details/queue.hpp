@@ -12,23 +12,38 @@
 #include <rpp/schedulers/fwd.hpp>
 
 #include <rpp/defs.hpp>
+#include <rpp/schedulers/details/schedulables_allocator.hpp>
 #include <rpp/schedulers/details/utils.hpp>
+#include <rpp/schedulers/instrumentation.hpp>
 #include <rpp/utils/constraints.hpp>
+#include <rpp/utils/intrusive_ptr.hpp>
 #include <rpp/utils/tuple.hpp>
 #include <rpp/utils/utils.hpp>
 
 #include "rpp/utils/functors.hpp"
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <condition_variable>
 #include <exception>
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <span>
 #include <utility>
 #include <variant>
+#include <vector>
 
 namespace rpp::schedulers::details
 {
+    class schedulable_base;
+
+    using schedulable_ptr = rpp::utils::intrusive_ptr<schedulable_base>;
+
+    /**
+     * @brief Type-erased scheduled action. Reference counter is embedded into object and memory is taken from `schedulables_allocator`, so each schedule costs no separate control block and no heap allocation in steady state.
+     */
     class schedulable_base
     {
     public:
@@ -37,8 +52,26 @@ namespace rpp::schedulers::details
         {
         }
 
+        schedulable_base(const schedulable_base&) = delete;
+        schedulable_base(schedulable_base&&)      = delete;
+
         virtual ~schedulable_base() noexcept = default;
 
+        static void* operator new(size_t size) { return schedulables_allocator::allocate(size); }
+        static void  operator delete(void* ptr, size_t size) noexcept { schedulables_allocator::deallocate(ptr, size); }
+
+        // over-aligned schedulables are rare, so they are served by global heap directly
+        static void* operator new(size_t size, std::align_val_t alignment) { return ::operator new(size, alignment); }
+        static void  operator delete(void* ptr, size_t, std::align_val_t alignment) noexcept { ::operator delete(ptr, alignment); }
+
+        void add_ref() noexcept { m_ref_count.fetch_add(1, std::memory_order_relaxed); }
+
+        void release() noexcept
+        {
+            if (m_ref_count.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                delete this;
+        }
+
         virtual std::optional<time_point> operator()() noexcept = 0;
 
         class advanced_call
@@ -81,11 +114,32 @@ namespace rpp::schedulers::details
 
         void set_timepoint(const time_point& timepoint) { m_time_point = timepoint; }
 
-        const std::shared_ptr<schedulable_base>& get_next() const { return m_next; }
+        rpp::schedulers::priority get_priority() const { return m_priority; }
 
-        void set_next(std::shared_ptr<schedulable_base>&& next) { m_next = std::move(next); }
+        /**
+         * @brief Timer slack requested for this schedulable via `worker::schedule(timer_slack, ...)`, `duration::min()` means "use slack of scheduler"
+         */
+        virtual duration get_timer_slack() const noexcept { return duration::min(); }
 
-        void update_next(std::shared_ptr<schedulable_base>&& next)
+        /**
+         * @brief Latest time_point this schedulable can be executed at without violating its timer slack
+         */
+        time_point get_latest_timepoint(duration default_slack) const
+        {
+            const auto own_slack = get_timer_slack();
+            const auto slack     = own_slack == duration::min() ? default_slack : own_slack;
+            if (m_time_point > time_point::max() - slack)
+                return time_point::max();
+            return m_time_point + slack;
+        }
+
+        const schedulable_ptr& get_next() const { return m_next; }
+
+        void set_next(schedulable_ptr&& next) { m_next = std::move(next); }
+
+        schedulable_ptr take_next() { return std::move(m_next); }
+
+        void update_next(schedulable_ptr&& next)
         {
             if (next)
                 next->set_next(std::move(m_next));
@@ -109,13 +163,16 @@ namespace rpp::schedulers::details
         }
 
     private:
-        std::shared_ptr<schedulable_base> m_next{};
-        time_point                        m_time_point;
+        schedulable_ptr       m_next{};
+        time_point            m_time_point;
+        std::atomic<uint32_t> m_ref_count{1};
+        // placed into padding after reference counter, so priority doesn't increase size of schedulable
+        priority m_priority{s_priority_override};
     };
 
     template<typename NowStrategy, rpp::constraint::decayed_type Fn, rpp::schedulers::constraint::schedulable_handler Handler, rpp::constraint::decayed_type... Args>
         requires constraint::schedulable_fn<Fn, Handler, Args...>
-    class specific_schedulable final : public schedulable_base
+    class specific_schedulable : public schedulable_base
     {
     public:
         template<rpp::constraint::decayed_same_as<Fn> TFn, typename... TArgs>
@@ -168,6 +225,37 @@ namespace rpp::schedulers::details
         RPP_NO_UNIQUE_ADDRESS Fn                                  m_fn;
     };
 
+    /**
+     * @brief Schedulable created while `timer_slack_scope` is active. Slack is stored only inside of such a schedulables, so default ones don't pay for it.
+     */
+    template<typename Schedulable>
+    class schedulable_with_timer_slack final : public Schedulable
+    {
+    public:
+        template<typename... TArgs>
+        explicit schedulable_with_timer_slack(duration slack, TArgs&&... args)
+            : Schedulable{std::forward<TArgs>(args)...}
+            , m_slack{slack}
+        {
+        }
+
+        duration get_timer_slack() const noexcept override { return m_slack; }
+
+    private:
+        duration m_slack;
+    };
+
+    template<typename NowStrategy, rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
+    schedulable_ptr make_schedulable(const time_point& timepoint, Fn&& fn, Handler&& handler, Args&&... args)
+    {
+        using schedulable_type = specific_schedulable<NowStrategy, std::decay_t<Fn>, std::decay_t<Handler>, std::decay_t<Args>...>;
+
+        if (const auto slack = s_timer_slack_override; slack != duration::min())
+            return schedulable_ptr{new schedulable_with_timer_slack<schedulable_type>(slack, timepoint, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...)};
+
+        return schedulable_ptr{new schedulable_type(timepoint, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...)};
+    }
+
     template<typename Mutex>
     class optional_mutex
     {
@@ -201,9 +289,93 @@ namespace rpp::schedulers::details
         std::recursive_mutex        mutex{};
     };
 
+    /**
+     * @brief FIFO of schedulables linked via their own `next` pointers, so it never allocates.
+     */
+    class schedulables_fifo
+    {
+    public:
+        schedulables_fifo() = default;
+
+        schedulables_fifo(schedulables_fifo&& other) noexcept
+            : m_head{std::move(other.m_head)}
+            , m_tail{std::exchange(other.m_tail, nullptr)}
+        {
+        }
+
+        schedulables_fifo& operator=(schedulables_fifo&& other) noexcept
+        {
+            m_head = std::move(other.m_head);
+            m_tail = std::exchange(other.m_tail, nullptr);
+            return *this;
+        }
+
+        bool empty() const { return !m_head; }
+
+        const schedulable_ptr&  front() const { return m_head; }
+        const schedulable_base* back() const { return m_tail; }
+
+        void push_back(schedulable_ptr&& schedulable)
+        {
+            auto* raw = schedulable.get();
+            if (m_tail)
+                m_tail->set_next(std::move(schedulable));
+            else
+                m_head = std::move(schedulable);
+            m_tail = raw;
+        }
+
+        schedulable_ptr pop_front()
+        {
+            auto res = std::exchange(m_head, m_head->take_next());
+            if (!m_head)
+                m_tail = nullptr;
+            return res;
+        }
+
+    private:
+        schedulable_ptr   m_head{};
+        schedulable_base* m_tail{};
+    };
+
+    /**
+     * @brief Strategy reads real `clock_type`, so time cached by `details::now()` never exceeds its "now" and can be used to detect due schedulables without requesting of clock.
+     */
+    template<typename NowStrategy>
+    concept real_clock_strategy = requires { requires NowStrategy::is_real_clock; };
+
+    /**
+     * @brief Queue of schedulables ordered by time_point (FIFO for equal time_points).
+     * @details Storage for future time_points is selected via `queue_backend`. Schedulables which are already due at the moment of emplacing (zero-delay re-schedules and etc.) are linked to separate intrusive FIFO instead, so they cost O(1) for both emplace and pop and consumers can execute them without any time checks (see `is_top_ready`). Disposed schedulables are not removed eagerly, they are just skipped by consumers when reach top of the queue, so cancellation is O(1) for any backend.
+     *
+     * Each `priority` has own lane with such a storage. Among due schedulables top is taken from the lane with highest priority, otherwise top is the earliest schedulable of all lanes. In case of non-zero `starvation_limit`, after such amount of schedulables in a row taken in front of earlier due schedulable of another lane, the earliest one is taken regardless of its priority. Till first schedulable with non-`normal` priority is emplaced, only lane of `normal` priority is used, so queues without priorities don't pay for other lanes.
+     */
     template<typename NowStrategy>
     class schedulables_queue
     {
+        struct heap_entry
+        {
+            time_point      timepoint;
+            size_t          order;
+            schedulable_ptr schedulable;
+
+            bool operator<(const heap_entry& other) const
+            {
+                return timepoint < other.timepoint || (timepoint == other.timepoint && order < other.order);
+            }
+        };
+
+        struct lane
+        {
+            schedulables_fifo       ready{};
+            schedulable_ptr         head{};
+            std::vector<heap_entry> heap{};
+        };
+
+        static constexpr size_t s_heap_arity  = 4;
+        static constexpr size_t s_lanes_count = static_cast<size_t>(priority::low) + 1;
+        static constexpr size_t s_normal_lane = static_cast<size_t>(priority::normal);
+
     public:
         schedulables_queue()                              = default;
         schedulables_queue(const schedulables_queue&)     = delete;
@@ -212,20 +384,31 @@ namespace rpp::schedulers::details
         schedulables_queue& operator=(const schedulables_queue& other)     = delete;
         schedulables_queue& operator=(schedulables_queue&& other) noexcept = default;
 
-        schedulables_queue(std::weak_ptr<shared_queue_data> shared_data)
-            : m_shared_data{std::move(shared_data)}
+        /**
+         * @param starvation_limit maximum amount of higher priority schedulables executed in a row in front of earlier due lower priority one. Zero means strict priority.
+         */
+        explicit schedulables_queue(queue_backend backend, size_t starvation_limit = 0)
+            : m_backend{backend}
+            , m_starvation_limit{starvation_limit}
+        {
+        }
+
+        /**
+         * @param mutex locked during each emplace in case of queue is filled by several threads. Should outlive the queue.
+         */
+        explicit schedulables_queue(std::recursive_mutex* mutex, queue_backend backend = queue_backend::linked_list)
+            : m_mutex{mutex}
+            , m_backend{backend}
         {
         }
 
         template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
         void emplace(const time_point& timepoint, Fn&& fn, Handler&& handler, Args&&... args)
         {
-            using schedulable_type = specific_schedulable<NowStrategy, std::decay_t<Fn>, std::decay_t<Handler>, std::decay_t<Args>...>;
-
-            emplace_impl(std::make_shared<schedulable_type>(timepoint, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...));
+            emplace_impl(make_schedulable<NowStrategy>(timepoint, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...));
         }
 
-        void emplace(const time_point& timepoint, std::shared_ptr<schedulable_base>&& schedulable)
+        void emplace(const time_point& timepoint, schedulable_ptr&& schedulable)
         {
             if (!schedulable)
                 return;
@@ -234,39 +417,116 @@ namespace rpp::schedulers::details
             emplace_impl(std::move(schedulable));
         }
 
-        bool is_empty() const { return !m_head; }
+        bool is_empty() const
+        {
+            if (!m_has_priorities)
+                return is_lane_empty(m_lanes[s_normal_lane]);
+
+            return std::all_of(m_lanes.begin(), m_lanes.end(), [this](const lane& l) { return is_lane_empty(l); });
+        }
+
+        /**
+         * @brief Top schedulable is taken from the FIFO of already due schedulables, so it can be executed without any time checks.
+         */
+        bool is_top_ready() const
+        {
+            return !is_empty() && is_lane_top_ready(m_lanes[select_lane().first]);
+        }
 
-        std::shared_ptr<schedulable_base> pop()
+        schedulable_ptr pop()
         {
-            return std::exchange(m_head, m_head->get_next());
+            m_size.decrement();
+
+            const auto [index, earliest] = select_lane();
+            m_overtaken_count            = index == earliest ? 0 : m_overtaken_count + 1;
+
+            auto& l = m_lanes[index];
+            if (is_lane_top_ready(l))
+                return l.ready.pop_front();
+
+            if (m_backend == queue_backend::heap)
+                return heap_pop(l);
+
+            return std::exchange(l.head, l.head->take_next());
         }
 
-        const std::shared_ptr<schedulable_base>& top() const
+        const schedulable_ptr& top() const
         {
-            return m_head;
+            return lane_top(m_lanes[select_lane().first]);
         }
 
+        /**
+         * @brief Time_point owner of the queue should wake up at to execute top schedulable.
+         * @details Equals to time_point of top schedulable in case of zero slack. Otherwise it is the earliest "time_point + slack" among all schedulables due before it, so all of them can be served by single wake-up. Time_points of schedulables are never changed, so periodic timers don't drift.
+         * @returns time_point::max() in case of empty queue
+         */
+        time_point get_wakeup_timepoint(duration default_slack) const
+        {
+            if (is_empty())
+                return time_point::max();
+
+            const auto& t = top();
+            if (is_top_ready())
+                return t->get_timepoint();
+
+            time_point res = t->get_latest_timepoint(default_slack);
+            for (const auto& l : get_used_lanes())
+            {
+                // already due schedulables from the FIFO can't wait for anything
+                if (!l.ready.empty())
+                    res = std::min(res, l.ready.front()->get_timepoint());
+
+                if (m_backend == queue_backend::heap)
+                    heap_min_latest_timepoint(l, 0, default_slack, res);
+                else
+                {
+                    for (const schedulable_base* current = l.head.get(); current && current->get_timepoint() < res; current = current->get_next().get())
+                        res = std::min(res, current->get_latest_timepoint(default_slack));
+                }
+            }
+            return res;
+        }
+
+        queue_backend get_backend() const { return m_backend; }
+
+        size_t get_starvation_limit() const { return m_starvation_limit; }
+
+        /**
+         * @brief Amount of schedulables inside of queue. Tracked only in case of enabled `RPP_SCHEDULERS_INSTRUMENTATION`, otherwise always 0.
+         */
+        size_t size() const { return m_size.get(); }
+
     private:
-        void emplace_impl(std::shared_ptr<schedulable_base>&& schedulable)
+        void emplace_impl(schedulable_ptr&& schedulable)
         {
-            // needed in case of new_thread and current_thread shares same queue
-            const auto                       s = m_shared_data.lock();
-            const rpp::utils::finally_action _{[&] {
-                if (s)
-                    s->cv.notify_one();
-            }};
+            std::lock_guard lock{m_mutex};
+
+            m_size.increment();
 
-            optional_mutex<std::recursive_mutex> mutex{s ? &s->mutex : nullptr};
-            std::lock_guard                      lock{mutex};
+            const auto index = static_cast<size_t>(schedulable->get_priority());
+            m_has_priorities |= index != s_normal_lane;
 
-            if (!m_head || schedulable->get_timepoint() < m_head->get_timepoint())
+            auto& l = m_lanes[index];
+            if (is_ready_in_order(l, schedulable->get_timepoint()))
             {
-                schedulable->set_next(std::move(m_head));
-                m_head = std::move(schedulable);
+                l.ready.push_back(std::move(schedulable));
                 return;
             }
 
-            schedulable_base* current = m_head.get();
+            if (m_backend == queue_backend::heap)
+            {
+                heap_push(l, std::move(schedulable));
+                return;
+            }
+
+            if (!l.head || schedulable->get_timepoint() < l.head->get_timepoint())
+            {
+                schedulable->set_next(std::move(l.head));
+                l.head = std::move(schedulable);
+                return;
+            }
+
+            schedulable_base* current = l.head.get();
             while (const auto& next = current->get_next())
             {
                 if (schedulable->get_timepoint() < next->get_timepoint())
@@ -277,8 +537,253 @@ namespace rpp::schedulers::details
             current->update_next(std::move(schedulable));
         }
 
+        // returns index of lane to take top from and index of lane with the earliest top
+        std::pair<size_t, size_t> select_lane() const
+        {
+            if (!m_has_priorities)
+                return {s_normal_lane, s_normal_lane};
+
+            size_t earliest = s_lanes_count;
+            for (size_t i = 0; i < s_lanes_count; ++i)
+            {
+                if (!is_lane_empty(m_lanes[i]) && (earliest == s_lanes_count || lane_top(m_lanes[i])->get_timepoint() < lane_top(m_lanes[earliest])->get_timepoint()))
+                    earliest = i;
+            }
+
+            if (m_starvation_limit != 0 && m_overtaken_count >= m_starvation_limit)
+                return {earliest, earliest};
+
+            for (size_t i = 0; i < earliest; ++i)
+            {
+                const auto& l = m_lanes[i];
+                if (!is_lane_empty(l) && (is_lane_top_ready(l) || lane_top(l)->get_timepoint() <= get_known_now()))
+                    return {i, earliest};
+            }
+            return {earliest, earliest};
+        }
+
+        // cached time of real clock is used as is, but strategies with own clock (virtual time and etc.) are asked directly
+        static time_point get_known_now()
+        {
+            if constexpr (real_clock_strategy<NowStrategy>)
+                return details::s_last_now_time;
+            else
+                return NowStrategy::now();
+        }
+
+        std::span<const lane> get_used_lanes() const
+        {
+            if (!m_has_priorities)
+                return {&m_lanes[s_normal_lane], 1};
+            return m_lanes;
+        }
+
+        // time_point is already reached (without requesting of clock) and emplacing to the FIFO keeps the same order as the timed queue would have
+        bool is_ready_in_order(const lane& l, time_point timepoint) const
+        {
+            if (timepoint > get_known_now())
+                return false;
+
+            if (!l.ready.empty() && timepoint < l.ready.back()->get_timepoint())
+                return false;
+
+            return is_timed_empty(l) || timepoint < timed_top(l)->get_timepoint();
+        }
+
+        bool is_lane_empty(const lane& l) const { return l.ready.empty() && is_timed_empty(l); }
+
+        bool is_lane_top_ready(const lane& l) const
+        {
+            if (l.ready.empty())
+                return false;
+
+            // ready schedulable is emplaced before any timed schedulable with same time_point
+            return is_timed_empty(l) || l.ready.front()->get_timepoint() <= timed_top(l)->get_timepoint();
+        }
+
+        const schedulable_ptr& lane_top(const lane& l) const
+        {
+            if (is_lane_top_ready(l))
+                return l.ready.front();
+
+            return timed_top(l);
+        }
+
+        bool is_timed_empty(const lane& l) const { return m_backend == queue_backend::heap ? l.heap.empty() : !l.head; }
+
+        const schedulable_ptr& timed_top(const lane& l) const
+        {
+            if (m_backend == queue_backend::heap)
+                return l.heap.front().schedulable;
+
+            return l.head;
+        }
+
+        void heap_push(lane& l, schedulable_ptr&& schedulable)
+        {
+            auto&      heap      = l.heap;
+            const auto timepoint = schedulable->get_timepoint();
+            heap.push_back(heap_entry{timepoint, m_order++, std::move(schedulable)});
+
+            size_t index = heap.size() - 1;
+            while (index > 0)
+            {
+                const size_t parent = (index - 1) / s_heap_arity;
+                if (!(heap[index] < heap[parent]))
+                    break;
+
+                std::swap(heap[index], heap[parent]);
+                index = parent;
+            }
+        }
+
+        // children are never earlier than parent, so subtrees starting after current result can be skipped
+        void heap_min_latest_timepoint(const lane& l, size_t index, duration default_slack, time_point& res) const
+        {
+            if (index >= l.heap.size() || !(l.heap[index].timepoint < res))
+                return;
+
+            res = std::min(res, l.heap[index].schedulable->get_latest_timepoint(default_slack));
+
+            const size_t first_child = index * s_heap_arity + 1;
+            for (size_t child = first_child; child < first_child + s_heap_arity; ++child)
+                heap_min_latest_timepoint(l, child, default_slack, res);
+        }
+
+        static schedulable_ptr heap_pop(lane& l)
+        {
+            auto& heap = l.heap;
+            auto  res  = std::move(heap.front().schedulable);
+            if (heap.size() > 1)
+                heap.front() = std::move(heap.back());
+            heap.pop_back();
+
+            size_t index = 0;
+            while (true)
+            {
+                const size_t first_child = index * s_heap_arity + 1;
+                if (first_child >= heap.size())
+                    break;
+
+                size_t min_child = first_child;
+                for (size_t child = first_child + 1; child < std::min(first_child + s_heap_arity, heap.size()); ++child)
+                {
+                    if (heap[child] < heap[min_child])
+                        min_child = child;
+                }
+
+                if (!(heap[min_child] < heap[index]))
+                    break;
+
+                std::swap(heap[index], heap[min_child]);
+                index = min_child;
+            }
+            return res;
+        }
+
+    private:
+        std::array<lane, s_lanes_count>      m_lanes{};
+        size_t                               m_order{};
+        optional_mutex<std::recursive_mutex> m_mutex{};
+        queue_backend                        m_backend{queue_backend::linked_list};
+        size_t                               m_starvation_limit{};
+        size_t                               m_overtaken_count{};
+        // only lane of `normal` priority is looked through till any other priority is used
+        bool m_has_priorities{};
+
+        RPP_NO_UNIQUE_ADDRESS instrumentation::queue_size_counter m_size{};
+    };
+
+    /**
+     * @brief Lock-free multi-producer inbox of schedulables submitted from other threads.
+     * @details Producers just push schedulable to the intrusive stack without any locks. Owner of the queue takes whole stack at once and splices it into own `schedulables_queue`, so time_point ordering is paid by consumer thread only. Order of submission is preserved during splicing.
+     */
+    template<typename NowStrategy>
+    class schedulables_inbox
+    {
+    public:
+        schedulables_inbox() = default;
+
+        schedulables_inbox(const schedulables_inbox&) = delete;
+        schedulables_inbox(schedulables_inbox&&)      = delete;
+
+        ~schedulables_inbox() noexcept { clear(); }
+
+        template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
+        void emplace(const time_point& timepoint, Fn&& fn, Handler&& handler, Args&&... args)
+        {
+            push(make_schedulable<NowStrategy>(timepoint, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...));
+        }
+
+        void emplace(const time_point& timepoint, schedulable_ptr&& schedulable)
+        {
+            if (!schedulable)
+                return;
+
+            schedulable->set_timepoint(timepoint);
+            push(std::move(schedulable));
+        }
+
+        bool is_empty() const { return m_head.load() == nullptr; }
+
+        /**
+         * @brief Moves all submitted schedulables to the queue in order of submission
+         */
+        void splice_to(schedulables_queue<NowStrategy>& queue)
+        {
+            auto current = take_all();
+            while (current)
+            {
+                auto next = current->take_next();
+                queue.emplace(current->get_timepoint(), std::move(current));
+                current = std::move(next);
+            }
+        }
+
+        void clear()
+        {
+            // unlink one by one to avoid recursive destruction of long chains
+            auto current = take_all();
+            while (current)
+                current = current->take_next();
+        }
+
+    private:
+        void push(schedulable_ptr&& schedulable)
+        {
+            auto* node = schedulable.detach();
+            auto* head = m_head.load(std::memory_order_relaxed);
+            while (true)
+            {
+                node->set_next(schedulable_ptr{head});
+                if (m_head.compare_exchange_weak(head, node))
+                    return;
+
+                // reference to old head is still owned by inbox
+                node->take_next().detach();
+            }
+        }
+
+        // returns schedulables in order of submission
+        schedulable_ptr take_all()
+        {
+            // cheap check to avoid read-modify-write in case of nothing submitted
+            if (!m_head.load(std::memory_order_relaxed))
+                return {};
+
+            schedulable_ptr current{m_head.exchange(nullptr)};
+            schedulable_ptr reversed{};
+            while (current)
+            {
+                auto next = current->take_next();
+                current->set_next(std::move(reversed));
+                reversed = std::move(current);
+                current  = std::move(next);
+            }
+            return reversed;
+        }
+
     private:
-        std::shared_ptr<schedulable_base> m_head{};
-        std::weak_ptr<shared_queue_data>  m_shared_data{};
+        std::atomic<schedulable_base*> m_head{};
     };
 } // namespace rpp::schedulers::details
@@ -0,0 +1,198 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace rpp::schedulers::details
+{
+    /**
+     * @brief Pool of memory blocks used for schedulables. Blocks are split into size classes and recycled instead of being returned to the heap.
+     * @details Each thread keeps own cache of free blocks per size class, so allocation and deallocation on the same thread are lock-free. Schedulable is frequently allocated in one thread and destroyed in another one (new_thread, run_loop), so excess blocks are moved in batches to the global depot where any other thread can pick them up.
+     */
+    class schedulables_allocator
+    {
+        static constexpr size_t s_block_step       = 64;
+        static constexpr size_t s_classes_count    = 8;
+        static constexpr size_t s_max_block_size   = s_block_step * s_classes_count;
+        static constexpr size_t s_batch_size       = 32;
+        static constexpr size_t s_max_local_blocks = 2 * s_batch_size;
+        static constexpr size_t s_max_depot_blocks = 64 * s_batch_size;
+
+        struct free_block
+        {
+            free_block* next;
+        };
+
+        struct free_list
+        {
+            free_block* head{};
+            size_t      size{};
+
+            void push(void* ptr)
+            {
+                head = ::new (ptr) free_block{head};
+                ++size;
+            }
+
+            void* pop()
+            {
+                --size;
+                return std::exchange(head, head->next);
+            }
+
+            // detaches first `count` blocks into separate list
+            free_list split(size_t count)
+            {
+                free_list res{head, count};
+                free_block* last = head;
+                for (size_t i = 1; i < count; ++i)
+                    last = last->next;
+
+                head = std::exchange(last->next, nullptr);
+                size -= count;
+                return res;
+            }
+
+            void release()
+            {
+                while (head)
+                    ::operator delete(std::exchange(head, head->next));
+                size = 0;
+            }
+        };
+
+        struct depot
+        {
+            depot() { batches.reserve(s_max_depot_blocks / s_batch_size); }
+
+            std::mutex             mutex{};
+            std::vector<free_list> batches{};
+        };
+
+        class thread_cache
+        {
+        public:
+            thread_cache() = default;
+
+            thread_cache(const thread_cache&) = delete;
+            thread_cache(thread_cache&&)      = delete;
+
+            ~thread_cache() noexcept
+            {
+                s_cache_destroyed = true;
+
+                for (size_t i = 0; i < s_classes_count; ++i)
+                {
+                    while (m_lists[i].size >= s_batch_size)
+                        return_batch(i, m_lists[i].split(s_batch_size));
+                    m_lists[i].release();
+                }
+            }
+
+            free_list& get(size_t size_class) { return m_lists[size_class]; }
+
+        private:
+            std::array<free_list, s_classes_count> m_lists{};
+        };
+
+    public:
+        static void* allocate(size_t size)
+        {
+            if (size > s_max_block_size)
+                return ::operator new(size);
+
+            const size_t size_class = get_size_class(size);
+            if (auto* cache = get_cache())
+            {
+                auto& list = cache->get(size_class);
+                if (!list.head)
+                    list = take_batch(size_class);
+
+                if (list.head)
+                    return list.pop();
+            }
+            return ::operator new(get_block_size(size_class));
+        }
+
+        static void deallocate(void* ptr, size_t size) noexcept
+        {
+            auto* cache = size > s_max_block_size ? nullptr : get_cache();
+            if (!cache)
+            {
+                ::operator delete(ptr);
+                return;
+            }
+
+            const size_t size_class = get_size_class(size);
+            auto&        list       = cache->get(size_class);
+            list.push(ptr);
+
+            if (list.size >= s_max_local_blocks)
+                return_batch(size_class, list.split(s_batch_size));
+        }
+
+    private:
+        static size_t get_size_class(size_t size) { return size == 0 ? 0 : (size - 1) / s_block_step; }
+        static size_t get_block_size(size_t size_class) { return (size_class + 1) * s_block_step; }
+
+        static thread_cache* get_cache()
+        {
+            // blocks can be deallocated by destructors of other thread_local objects after destruction of cache
+            if (s_cache_destroyed)
+                return nullptr;
+
+            thread_local thread_cache s_cache{};
+            return &s_cache;
+        }
+
+        static depot& get_depot(size_t size_class)
+        {
+            // intentionally leaked: detached threads can return blocks during static destruction
+            static auto* s_depots = new std::array<depot, s_classes_count>{};
+            return (*s_depots)[size_class];
+        }
+
+        static free_list take_batch(size_t size_class)
+        {
+            auto&           d = get_depot(size_class);
+            std::lock_guard lock{d.mutex};
+            if (d.batches.empty())
+                return {};
+
+            auto res = d.batches.back();
+            d.batches.pop_back();
+            return res;
+        }
+
+        static void return_batch(size_t size_class, free_list batch) noexcept
+        {
+            {
+                auto&           d = get_depot(size_class);
+                std::lock_guard lock{d.mutex};
+                if (d.batches.size() * s_batch_size < s_max_depot_blocks)
+                {
+                    d.batches.push_back(batch);
+                    return;
+                }
+            }
+            batch.release();
+        }
+
+    private:
+        static inline thread_local bool s_cache_destroyed{};
+    };
+} // namespace rpp::schedulers::details
@@ -0,0 +1,158 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+    #include <fstream>
+    #include <pthread.h>
+    #include <sched.h>
+#endif
+
+namespace rpp::schedulers::details
+{
+    /**
+     * @brief Parses list of cpus (or NUMA nodes) in linux format like "0-3,8,10-11"
+     */
+    inline std::vector<size_t> parse_cpu_list(std::string_view list)
+    {
+        std::vector<size_t> res{};
+        while (!list.empty())
+        {
+            const auto        comma = list.find(',');
+            const std::string range{list.substr(0, comma)};
+            list = comma == std::string_view::npos ? std::string_view{} : list.substr(comma + 1);
+
+            const auto dash = range.find('-');
+            try
+            {
+                const size_t first = std::stoul(range.substr(0, dash));
+                const size_t last  = dash == std::string::npos ? first : std::stoul(range.substr(dash + 1));
+                for (size_t cpu = first; cpu <= last; ++cpu)
+                    res.push_back(cpu);
+            }
+            catch (...)
+            {
+                // skip malformed ranges (including trailing whitespaces)
+            }
+        }
+        return res;
+    }
+
+#if defined(__linux__)
+    /**
+     * @brief Reads first line of the file. Returns empty string in case of missing file.
+     */
+    inline std::string read_first_line(const std::string& path)
+    {
+        std::ifstream file{path};
+        std::string   line{};
+        if (file)
+            std::getline(file, line);
+        return line;
+    }
+#endif
+
+    /**
+     * @brief Cpus of each NUMA node of the system. Machine without NUMA (or non-linux one) is represented as single node with all cpus.
+     * @details Only online nodes having cpus are listed: numbering of nodes can be sparse and memory-only nodes can't run any worker.
+     */
+    inline const std::vector<std::vector<size_t>>& get_numa_nodes()
+    {
+        static const auto s_nodes = [] {
+            std::vector<std::vector<size_t>> nodes{};
+#if defined(__linux__)
+            for (const auto node : parse_cpu_list(read_first_line("/sys/devices/system/node/online")))
+            {
+                auto cpus = parse_cpu_list(read_first_line("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist"));
+                if (!cpus.empty())
+                    nodes.push_back(std::move(cpus));
+            }
+#endif
+            if (nodes.empty())
+            {
+                nodes.emplace_back();
+                for (size_t cpu = 0; cpu < std::max(1u, std::thread::hardware_concurrency()); ++cpu)
+                    nodes.back().push_back(cpu);
+            }
+            return nodes;
+        }();
+        return s_nodes;
+    }
+
+    /**
+     * @brief Index of NUMA node (inside `get_numa_nodes()`) of the cpu current thread is running on
+     */
+    inline size_t get_current_numa_node()
+    {
+        const auto& nodes = get_numa_nodes();
+        if (nodes.size() == 1)
+            return 0;
+
+#if defined(__linux__)
+        if (const int cpu = sched_getcpu(); cpu >= 0)
+        {
+            for (size_t node = 0; node < nodes.size(); ++node)
+            {
+                for (const auto node_cpu : nodes[node])
+                {
+                    if (node_cpu == static_cast<size_t>(cpu))
+                        return node;
+                }
+            }
+        }
+#endif
+        return 0;
+    }
+
+    /**
+     * @brief Restricts current thread to provided cpus. Does nothing for empty list.
+     * @returns true if affinity was applied
+     */
+    inline bool set_current_thread_affinity(const std::vector<size_t>& cpus)
+    {
+        if (cpus.empty())
+            return false;
+
+#if defined(__linux__)
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        for (const auto cpu : cpus)
+        {
+            if (cpu < CPU_SETSIZE)
+                CPU_SET(cpu, &set);
+        }
+        return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * @brief Sets name of current thread visible in debuggers and profilers. Linux limits name to 15 characters, so it is truncated.
+     */
+    inline void set_current_thread_name([[maybe_unused]] const std::string& name)
+    {
+        if (name.empty())
+            return;
+
+#if defined(__linux__)
+        pthread_setname_np(pthread_self(), name.substr(0, 15).c_str());
+#endif
+    }
+} // namespace rpp::schedulers::details
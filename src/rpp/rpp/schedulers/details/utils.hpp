@@ -11,26 +11,166 @@
 
 #include <rpp/schedulers/fwd.hpp>
 
+#include <concepts>
 #include <exception>
 #include <optional>
 #include <thread>
+#include <utility>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    #include <intrin.h>
+#endif
 
 namespace rpp::schedulers::details
 {
     inline thread_local time_point s_last_now_time{};
 
+    // slack requested via `worker::schedule(timer_slack, ...)` for schedulables created in this thread, `duration::min()` means "use slack of scheduler"
+    inline thread_local duration s_timer_slack_override{duration::min()};
+
+    // priority requested via `worker::schedule(priority, ...)` for schedulables created in this thread
+    inline thread_local priority s_priority_override{priority::normal};
+
+    // precision of sleeping of current thread, see `sleep_precision_scope`
+    inline thread_local sleep_precision s_sleep_precision{};
+
+    /**
+     * @brief Overrides priority of schedulables created in this thread while scope is alive. Same as `timer_slack_scope`, thread_local storage is touched only in case of requested priority differs from the current one.
+     */
+    class priority_scope
+    {
+    public:
+        explicit priority_scope(priority value)
+        {
+            if (s_priority_override != value)
+                m_previous = std::exchange(s_priority_override, value);
+        }
+
+        priority_scope(const priority_scope&) = delete;
+        priority_scope(priority_scope&&)      = delete;
+
+        ~priority_scope() noexcept
+        {
+            if (m_previous)
+                s_priority_override = m_previous.value();
+        }
+
+    private:
+        std::optional<priority> m_previous{};
+    };
+
+    /**
+     * @brief Overrides slack of schedulables created in this thread while scope is alive. Thread_local storage is touched only in case of requested slack differs from the current one, so resetting of slack costs nothing while no override is active.
+     */
+    class timer_slack_scope
+    {
+    public:
+        explicit timer_slack_scope(duration slack)
+        {
+            if (s_timer_slack_override != slack)
+                m_previous = std::exchange(s_timer_slack_override, slack);
+        }
+
+        timer_slack_scope(const timer_slack_scope&) = delete;
+        timer_slack_scope(timer_slack_scope&&)      = delete;
+
+        ~timer_slack_scope() noexcept
+        {
+            if (m_previous)
+                s_timer_slack_override = m_previous.value();
+        }
+
+    private:
+        std::optional<duration> m_previous{};
+    };
+
     inline rpp::schedulers::time_point now()
     {
         return s_last_now_time = clock_type::now();
     }
 
+    /**
+     * @brief Hints cpu that current thread is inside of busy-wait loop
+     */
+    inline void cpu_relax()
+    {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+        _mm_pause();
+#elif defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+        asm volatile("yield");
+#endif
+    }
+
+    /**
+     * @brief Spins and yields according to provided strategy till predicate becomes true
+     * @returns true if predicate became true, false if strategy is exhausted and thread should be parked
+     */
+    template<std::predicate Predicate>
+    bool idle_until(const idle_strategy& strategy, const Predicate& pred)
+    {
+        for (size_t i = 0; i < strategy.spin_count; ++i)
+        {
+            if (pred())
+                return true;
+            cpu_relax();
+        }
+
+        for (size_t i = 0; i < strategy.yield_count; ++i)
+        {
+            if (pred())
+                return true;
+            std::this_thread::yield();
+        }
+        return false;
+    }
+
+    /**
+     * @brief Busy-spins on clock of provided precision till timepoint or till predicate becomes true
+     * @returns true if spinning is done, false if timepoint is too far for spinning and thread should sleep till `timepoint - spin_threshold` first
+     */
+    template<std::predicate Predicate>
+    bool spin_until(const sleep_precision& precision, const time_point timepoint, const Predicate& pred)
+    {
+        if (precision.spin_threshold <= duration::zero() || timepoint - precision.clock() > precision.spin_threshold)
+            return false;
+
+        while (!pred() && precision.clock() < timepoint)
+            cpu_relax();
+        return true;
+    }
+
+    inline void precise_sleep_until(const time_point timepoint)
+    {
+        const auto& precision = s_sleep_precision;
+        if (precision.spin_threshold <= duration::zero())
+        {
+            std::this_thread::sleep_for(timepoint - clock_type::now());
+            return;
+        }
+
+        if (const auto now = clock_type::now(); timepoint - now > precision.spin_threshold)
+            std::this_thread::sleep_for(timepoint - precision.spin_threshold - now);
+        spin_until(precision, timepoint, [] { return false; });
+    }
+
+    inline void sleep_for(const duration duration)
+    {
+        if (s_sleep_precision.spin_threshold <= duration::zero())
+            std::this_thread::sleep_for(duration);
+        else
+            precise_sleep_until(clock_type::now() + duration);
+    }
+
     inline bool sleep_until(const time_point timepoint)
     {
         if (timepoint <= details::s_last_now_time)
             return false;
 
         const auto now = clock_type::now();
-        std::this_thread::sleep_for(timepoint - now);
+        if (timepoint > now)
+            precise_sleep_until(timepoint);
         details::s_last_now_time = std::max(now, timepoint);
         return timepoint > now;
     }
@@ -46,6 +186,9 @@ namespace rpp::schedulers::details
                                                                    Handler&&                                                                     handler,
                                                                    Args&&... args) noexcept
     {
+        // schedulings made by schedulable executed in place should use slack and priority of their own schedulers
+        const timer_slack_scope reset_slack{duration::min()};
+        const priority_scope    reset_priority{priority::normal};
         auto timepoint = NowStrategy::now() + duration;
         while (condition())
         {
@@ -83,6 +226,9 @@ namespace rpp::schedulers::details
                                                                    Handler&&                                                          handler,
                                                                    Args&&... args) noexcept
     {
+        // schedulings made by schedulable executed in place should use slack and priority of their own schedulers
+        const timer_slack_scope reset_slack{duration::min()};
+        const priority_scope    reset_priority{priority::normal};
         while (condition())
         {
             if (handler.is_disposed())
@@ -90,7 +236,7 @@ namespace rpp::schedulers::details
 
             if (duration > duration::zero())
             {
-                std::this_thread::sleep_for(duration);
+                details::sleep_for(duration);
 
                 if (handler.is_disposed())
                     return std::nullopt;
@@ -124,6 +270,9 @@ namespace rpp::schedulers::details
                                                                    Handler&&                                                    handler,
                                                                    Args&&... args) noexcept
     {
+        // schedulings made by schedulable executed in place should use slack and priority of their own schedulers
+        const timer_slack_scope reset_slack{duration::min()};
+        const priority_scope    reset_priority{priority::normal};
         std::optional<time_point> timepoint{};
         while (condition())
         {
@@ -134,7 +283,7 @@ namespace rpp::schedulers::details
             {
                 if (duration > duration::zero())
                 {
-                    std::this_thread::sleep_for(duration);
+                    details::sleep_for(duration);
 
                     if (handler.is_disposed())
                         return std::nullopt;
@@ -160,3 +309,26 @@ namespace rpp::schedulers::details
         return timepoint;
     }
 } // namespace rpp::schedulers::details
+
+namespace rpp::schedulers
+{
+    /**
+     * @brief Configures precision of sleeping of current thread while scope is alive: `immediate` and `current_thread` schedulers sleep till time_point of schedulables according to provided `sleep_precision`.
+     */
+    class sleep_precision_scope
+    {
+    public:
+        explicit sleep_precision_scope(sleep_precision precision)
+            : m_previous{std::exchange(details::s_sleep_precision, precision)}
+        {
+        }
+
+        sleep_precision_scope(const sleep_precision_scope&) = delete;
+        sleep_precision_scope(sleep_precision_scope&&)      = delete;
+
+        ~sleep_precision_scope() noexcept { details::s_sleep_precision = m_previous; }
+
+    private:
+        sleep_precision m_previous;
+    };
+} // namespace rpp::schedulers
@@ -0,0 +1,442 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/schedulers/fwd.hpp>
+
+#include <rpp/schedulers/current_thread.hpp>
+#include <rpp/schedulers/details/queue.hpp>
+#include <rpp/schedulers/details/utils.hpp>
+#include <rpp/schedulers/instrumentation.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace rpp::schedulers::details
+{
+    /**
+     * @brief Unit of work for `work_stealing_pool`. Pool guarantees that same task is never executed by two threads at the same time as long as task submits itself only once before being run.
+     */
+    class work_stealing_task
+    {
+    public:
+        virtual ~work_stealing_task() noexcept = default;
+
+        // executes ready part of task in the current thread of the pool
+        virtual void run() noexcept = 0;
+
+        // called by pool when timer registered via `work_stealing_pool::submit_at` is expired
+        virtual void on_timer(size_t generation) noexcept = 0;
+    };
+
+    /**
+     * @brief Fixed set of threads where each thread has own local deque of ready tasks. Idle threads steal ready tasks from busy ones.
+     * @details Tasks submitted from thread of pool are placed to local deque of this thread, tasks from any other threads are placed to shared queue. Owner thread takes tasks from the front of own deque, thieves take tasks from the back.
+     */
+    class work_stealing_pool final
+    {
+        struct local_queue
+        {
+            std::mutex                                      mutex{};
+            std::deque<std::shared_ptr<work_stealing_task>> tasks{};
+        };
+
+        struct timer
+        {
+            time_point                        timepoint;
+            size_t                            generation;
+            std::weak_ptr<work_stealing_task> task;
+
+            bool operator>(const timer& other) const { return timepoint > other.timepoint; }
+        };
+
+        struct state_t
+        {
+            explicit state_t(size_t threads_count)
+                : locals(threads_count)
+            {
+            }
+
+            std::vector<local_queue> locals;
+
+            std::mutex                                                     mutex{};
+            std::condition_variable                                        cv{};
+            std::deque<std::shared_ptr<work_stealing_task>>                global{};
+            std::priority_queue<timer, std::vector<timer>, std::greater<>> timers{};
+            bool                                                           is_stopping{};
+
+            std::atomic<size_t>          global_size{};
+            std::atomic<size_t>          sleeping{};
+            std::atomic<time_point::rep> next_timer{time_point::max().time_since_epoch().count()};
+        };
+
+        struct thread_context
+        {
+            const state_t* state{};
+            size_t         index{};
+        };
+
+    public:
+        /**
+         * @param on_thread_start invoked inside of each thread of the pool with index of this thread before processing of any task
+         * @param idle strategy of waiting for new tasks before sleeping
+         * @param timer_slack default timer slack of schedulables of serial queues of this pool
+         */
+        explicit work_stealing_pool(size_t threads_count, const std::function<void(size_t)>& on_thread_start = {}, idle_strategy idle = {}, duration timer_slack = {})
+            : m_state{std::make_shared<state_t>(std::max(size_t{1}, threads_count))}
+            , m_timer_slack{timer_slack}
+        {
+            m_threads.reserve(m_state->locals.size());
+            for (size_t i = 0; i < m_state->locals.size(); ++i)
+                m_threads.emplace_back(&thread_loop, m_state, i, on_thread_start, idle);
+        }
+
+        work_stealing_pool(const work_stealing_pool&) = delete;
+        work_stealing_pool(work_stealing_pool&&)      = delete;
+
+        ~work_stealing_pool() noexcept
+        {
+            {
+                std::lock_guard lock{m_state->mutex};
+                m_state->is_stopping = true;
+            }
+            m_state->cv.notify_all();
+
+            for (auto& thread : m_threads)
+                thread.detach();
+        }
+
+        /**
+         * @brief Submit task ready to be executed right now
+         */
+        void submit(std::shared_ptr<work_stealing_task> task) const
+        {
+            const auto& context = get_context();
+            if (context.state == m_state.get())
+            {
+                {
+                    auto&           local = m_state->locals[context.index];
+                    std::lock_guard lock{local.mutex};
+                    local.tasks.push_back(std::move(task));
+                }
+                wake_up_sleeping();
+                return;
+            }
+
+            {
+                std::lock_guard lock{m_state->mutex};
+                m_state->global.push_back(std::move(task));
+                m_state->global_size.fetch_add(1);
+            }
+            m_state->cv.notify_one();
+        }
+
+        /**
+         * @brief Register timer to call `work_stealing_task::on_timer` with provided generation at provided timepoint
+         */
+        void submit_at(time_point timepoint, size_t generation, std::weak_ptr<work_stealing_task> task) const
+        {
+            bool is_earliest{};
+            {
+                std::lock_guard lock{m_state->mutex};
+                m_state->timers.push(timer{timepoint, generation, std::move(task)});
+                is_earliest = m_state->timers.top().timepoint == timepoint;
+                if (is_earliest)
+                    m_state->next_timer.store(timepoint.time_since_epoch().count());
+            }
+            if (is_earliest)
+                m_state->cv.notify_one();
+        }
+
+        size_t threads_count() const { return m_state->locals.size(); }
+
+        duration get_timer_slack() const { return m_timer_slack; }
+
+    private:
+        static thread_context& get_context()
+        {
+            thread_local thread_context s_context{};
+            return s_context;
+        }
+
+        void wake_up_sleeping() const
+        {
+            if (m_state->sleeping.load() == 0)
+                return;
+
+            {
+                std::lock_guard lock{m_state->mutex};
+            }
+            m_state->cv.notify_one();
+        }
+
+        static std::shared_ptr<work_stealing_task> pop(state_t& state, size_t index)
+        {
+            {
+                auto&           local = state.locals[index];
+                std::lock_guard lock{local.mutex};
+                if (!local.tasks.empty())
+                {
+                    auto task = std::move(local.tasks.front());
+                    local.tasks.pop_front();
+                    return task;
+                }
+            }
+
+            if (state.global_size.load() != 0)
+            {
+                std::lock_guard lock{state.mutex};
+                if (!state.global.empty())
+                {
+                    auto task = std::move(state.global.front());
+                    state.global.pop_front();
+                    state.global_size.fetch_sub(1);
+                    return task;
+                }
+            }
+
+            for (size_t i = 1; i < state.locals.size(); ++i)
+            {
+                auto&           victim = state.locals[(index + i) % state.locals.size()];
+                std::lock_guard lock{victim.mutex};
+                if (!victim.tasks.empty())
+                {
+                    auto task = std::move(victim.tasks.back());
+                    victim.tasks.pop_back();
+                    return task;
+                }
+            }
+            return {};
+        }
+
+        static bool has_ready_tasks_unsafe(state_t& state)
+        {
+            if (!state.global.empty())
+                return true;
+
+            for (auto& local : state.locals)
+            {
+                std::lock_guard lock{local.mutex};
+                if (!local.tasks.empty())
+                    return true;
+            }
+            return false;
+        }
+
+        static bool process_timers(state_t& state)
+        {
+            std::vector<timer> expired{};
+            {
+                std::lock_guard lock{state.mutex};
+                const auto      now = details::now();
+                while (!state.timers.empty() && (state.timers.top().timepoint <= now || state.timers.top().task.expired()))
+                {
+                    expired.push_back(state.timers.top());
+                    state.timers.pop();
+                }
+                state.next_timer.store((state.timers.empty() ? time_point::max() : state.timers.top().timepoint).time_since_epoch().count());
+            }
+
+            for (const auto& t : expired)
+            {
+                if (const auto task = t.task.lock())
+                    task->on_timer(t.generation);
+            }
+            return !expired.empty();
+        }
+
+        static void thread_loop(std::shared_ptr<state_t> state, size_t index, std::function<void(size_t)> on_thread_start, idle_strategy idle)
+        {
+            if (on_thread_start)
+                on_thread_start(index);
+
+            get_context() = thread_context{state.get(), index};
+
+            while (true)
+            {
+                if (state->next_timer.load() <= details::now().time_since_epoch().count() && process_timers(*state))
+                    continue;
+
+                if (const auto task = pop(*state, index))
+                {
+                    task->run();
+                    continue;
+                }
+
+                // spinning thread is not counted as sleeping, so only shared queue and timers can be observed without locks
+                if (details::idle_until(idle, [&] { return state->global_size.load() != 0 || state->next_timer.load() <= details::now().time_since_epoch().count(); }))
+                    continue;
+
+                std::unique_lock lock{state->mutex};
+                state->sleeping.fetch_add(1);
+                const rpp::utils::finally_action _{[&] { state->sleeping.fetch_sub(1); }};
+
+                if (has_ready_tasks_unsafe(*state))
+                    continue;
+
+                if (state->timers.empty())
+                {
+                    if (state->is_stopping)
+                        break;
+
+                    state->cv.wait(lock);
+                }
+                else
+                {
+                    state->cv.wait_until(lock, state->timers.top().timepoint);
+                }
+            }
+
+            get_context() = thread_context{};
+        }
+
+    private:
+        std::shared_ptr<state_t> m_state;
+        std::vector<std::thread> m_threads{};
+        duration                 m_timer_slack{};
+    };
+
+    /**
+     * @brief Queue of schedulables executed by threads of `work_stealing_pool`, but never by two threads at the same time. As a result, schedulables of the same queue are serialized and executed in time_point order.
+     */
+    class serial_queue final : public work_stealing_task
+        , public std::enable_shared_from_this<serial_queue>
+    {
+        enum class state : uint8_t
+        {
+            idle,
+            waiting,
+            ready
+        };
+
+    public:
+        explicit serial_queue(std::shared_ptr<work_stealing_pool> pool)
+            : m_pool{std::move(pool)}
+        {
+        }
+
+        static std::shared_ptr<serial_queue> make(std::shared_ptr<work_stealing_pool> pool)
+        {
+            return std::make_shared<serial_queue>(std::move(pool));
+        }
+
+        template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
+        void defer_to(time_point time_point, Fn&& fn, Handler&& handler, Args&&... args)
+        {
+            std::lock_guard lock{m_mutex};
+            m_queue.emplace(time_point, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+            m_has_fresh_data.store(true);
+            request_execution_unsafe(m_queue.get_wakeup_timepoint(m_pool->get_timer_slack()));
+        }
+
+        void run() noexcept override
+        {
+            current_thread::get_queue() = &m_queue;
+            drain();
+            current_thread::get_queue() = nullptr;
+
+            std::lock_guard lock{m_mutex};
+            m_state = state::idle;
+            if (!m_queue.is_empty())
+                request_execution_unsafe(m_queue.get_wakeup_timepoint(m_pool->get_timer_slack()));
+        }
+
+        void on_timer(size_t generation) noexcept override
+        {
+            std::lock_guard lock{m_mutex};
+            if (m_state != state::waiting || m_generation != generation)
+                return;
+
+            m_state = state::ready;
+            m_pool->submit(shared_from_this());
+        }
+
+    private:
+        void request_execution_unsafe(time_point timepoint)
+        {
+            if (m_state == state::ready || (m_state == state::waiting && m_wakeup_time <= timepoint))
+                return;
+
+            ++m_generation;
+            if (timepoint <= details::s_last_now_time)
+            {
+                m_state = state::ready;
+                m_pool->submit(shared_from_this());
+            }
+            else
+            {
+                m_state       = state::waiting;
+                m_wakeup_time = timepoint;
+                m_pool->submit_at(timepoint, m_generation, weak_from_this());
+            }
+        }
+
+        void drain() noexcept
+        {
+            while (true)
+            {
+                std::unique_lock lock{m_mutex};
+                if (m_queue.is_empty())
+                    return;
+
+                if (m_queue.top()->is_disposed())
+                {
+                    m_queue.pop();
+                    instrumentation::on_disposed_skipped(instrumentation::scheduler_kind::thread_pool);
+                    continue;
+                }
+
+                if (!m_queue.is_top_ready() && details::s_last_now_time < m_queue.top()->get_timepoint() && current_thread::worker_strategy::now() < m_queue.top()->get_timepoint())
+                    return;
+
+                instrumentation::on_queue_depth(instrumentation::scheduler_kind::thread_pool, m_queue.size());
+                auto top = m_queue.pop();
+                m_has_fresh_data.store(!m_queue.is_empty());
+                lock.unlock();
+
+                auto expected = std::optional{top->get_timepoint()};
+                while (true)
+                {
+                    // each execution is recorded separately, re-execution in place has no expected time_point
+                    if (const auto res = instrumentation::record_execution(instrumentation::scheduler_kind::thread_pool, std::exchange(expected, std::nullopt), [&] { return top->make_advanced_call(); }))
+                    {
+                        if (!top->is_disposed())
+                        {
+                            if (res->can_run_immediately() && !m_has_fresh_data.load())
+                                continue;
+
+                            const auto tp = top->handle_advanced_call(res.value());
+                            m_queue.emplace(tp, std::move(top));
+                        }
+                    }
+                    break;
+                }
+            }
+        }
+
+    private:
+        std::shared_ptr<work_stealing_pool>                 m_pool;
+        // queue is also filled directly by current_thread schedulings during `run`, so it locks the same mutex
+        std::recursive_mutex                                m_mutex{};
+        schedulables_queue<current_thread::worker_strategy> m_queue{&m_mutex};
+        std::atomic_bool                                    m_has_fresh_data{};
+        state                                               m_state{state::idle};
+        size_t                                              m_generation{};
+        time_point                                          m_wakeup_time{};
+    };
+} // namespace rpp::schedulers::details
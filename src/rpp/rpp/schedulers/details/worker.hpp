@@ -14,8 +14,11 @@
 
 #include <rpp/defs.hpp>
 #include <rpp/disposables/disposable_wrapper.hpp>
+#include <rpp/schedulers/details/utils.hpp>
 #include <rpp/utils/constraints.hpp>
 
+#include <algorithm>
+
 namespace rpp::schedulers
 {
     template<rpp::schedulers::constraint::strategy Strategy>
@@ -56,6 +59,54 @@ namespace rpp::schedulers
                 schedule(tp - now(), std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
         }
 
+        /**
+         * @brief Same as `schedule`, but overrides timer slack of scheduler for this schedulable and all its re-schedules.
+         * @note Available only for queue-based schedulers, see `constraint::queue_based_strategy`.
+         */
+        template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
+            requires constraint::queue_based_strategy<Strategy>
+        void schedule(const timer_slack slack, const duration delay, Fn&& fn, Handler&& handler, Args&&... args) const
+        {
+            const details::timer_slack_scope _{std::max(duration::zero(), slack.value)};
+            schedule(delay, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief Same as `schedule`, but overrides timer slack of scheduler for this schedulable and all its re-schedules.
+         * @note Available only for queue-based schedulers, see `constraint::queue_based_strategy`.
+         */
+        template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
+            requires constraint::queue_based_strategy<Strategy>
+        void schedule(const timer_slack slack, const time_point tp, Fn&& fn, Handler&& handler, Args&&... args) const
+        {
+            const details::timer_slack_scope _{std::max(duration::zero(), slack.value)};
+            schedule(tp, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief Same as `schedule`, but schedulable and all its re-schedules are executed with provided priority.
+         * @note Available only for queue-based schedulers, see `constraint::queue_based_strategy`.
+         */
+        template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
+            requires constraint::queue_based_strategy<Strategy>
+        void schedule(const priority priority_class, const duration delay, Fn&& fn, Handler&& handler, Args&&... args) const
+        {
+            const details::priority_scope _{priority_class};
+            schedule(delay, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief Same as `schedule`, but schedulable and all its re-schedules are executed with provided priority.
+         * @note Available only for queue-based schedulers, see `constraint::queue_based_strategy`.
+         */
+        template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
+            requires constraint::queue_based_strategy<Strategy>
+        void schedule(const priority priority_class, const time_point tp, Fn&& fn, Handler&& handler, Args&&... args) const
+        {
+            const details::priority_scope _{priority_class};
+            schedule(tp, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+        }
+
         static rpp::schedulers::time_point now() { return Strategy::now(); }
 
     private:
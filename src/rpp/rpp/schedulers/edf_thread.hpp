@@ -0,0 +1,348 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/schedulers/fwd.hpp>
+
+#include <rpp/schedulers/current_thread.hpp>
+#include <rpp/schedulers/details/utils.hpp>
+#include <rpp/schedulers/details/worker.hpp>
+#include <rpp/schedulers/instrumentation.hpp>
+#include <rpp/utils/exceptions.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace rpp::schedulers
+{
+    /**
+     * @brief Scheduler with single own thread executing due schedulables of all its workers in earliest-deadline-first order.
+     * @details Time_point of schedulable is the time it can be started at, while deadline is the time it has to be started before: deadline of each schedulable is its time_point plus relative deadline of its worker (`create_worker(deadline)` or `options::deadline`).
+     * Among due schedulables thread always picks the one with the earliest deadline. Schedulable started after its deadline is "missed": it is counted by `get_missed_count()` and reported via `options::on_deadline_miss`. By default missed schedulable is still executed, while in case of `miss_policy::drop` it is destroyed without execution and its handler receives `on_error` with `rpp::utils::deadline_missed`, so downstream sees end of the stream instead of silent stall. As a result, overloaded scheduler sheds stale work instead of falling further behind.
+     * While schedulable is executed, `current_thread` schedulings made by it are trampolined and executed right after it by the same thread.
+     *
+     * @warning Thread is finished when scheduler and all its workers are destroyed and all pending schedulables are executed or dropped.
+     *
+     * @par Example
+     * @snippet edf_thread.cpp edf_thread
+     *
+     * @ingroup schedulers
+     */
+    class edf_thread final
+    {
+    public:
+        enum class miss_policy : uint8_t
+        {
+            // missed schedulable is destroyed without execution, its handler receives `on_error` with `rpp::utils::deadline_missed`
+            drop,
+            // missed schedulable is still executed, miss is only reported
+            execute
+        };
+
+        struct deadline_miss
+        {
+            time_point timepoint{};
+            time_point deadline{};
+            time_point now{};
+            bool       dropped{};
+        };
+
+        struct options
+        {
+            /**
+             * @brief Relative deadline of workers created via `create_worker()`. `duration::max()` means no deadline.
+             */
+            duration deadline{duration::max()};
+            /**
+             * @brief What to do with schedulable started after its deadline
+             */
+            miss_policy policy{miss_policy::execute};
+            /**
+             * @brief Invoked from the thread of scheduler for each missed schedulable
+             */
+            std::function<void(const deadline_miss&)> on_deadline_miss{};
+        };
+
+    private:
+        class worker_strategy;
+
+        struct entry
+        {
+            time_point               deadline;
+            size_t                   order;
+            duration                 relative_deadline;
+            details::schedulable_ptr schedulable;
+        };
+
+        // min-heaps: timers are ordered by time_point, ready ones by deadline. Equal keys are kept in FIFO order via `order`.
+        struct by_timepoint
+        {
+            bool operator()(const entry& l, const entry& r) const
+            {
+                const auto ltp = l.schedulable->get_timepoint();
+                const auto rtp = r.schedulable->get_timepoint();
+                return ltp > rtp || (ltp == rtp && l.order > r.order);
+            }
+        };
+
+        struct by_deadline
+        {
+            bool operator()(const entry& l, const entry& r) const
+            {
+                return l.deadline > r.deadline || (l.deadline == r.deadline && l.order > r.order);
+            }
+        };
+
+        struct queue_data
+        {
+            explicit queue_data(options&& opts)
+                : opts{std::move(opts)}
+            {
+            }
+
+            const options           opts;
+            std::mutex              mutex{};
+            std::condition_variable cv{};
+            std::vector<entry>      timers{};
+            std::vector<entry>      ready{};
+            size_t                  order{};
+            bool                    is_stoping{};
+            std::atomic<size_t>     missed{};
+
+            void push(details::schedulable_ptr&& schedulable, duration relative_deadline)
+            {
+                const auto timepoint = schedulable->get_timepoint();
+                const auto deadline  = relative_deadline >= time_point::max() - timepoint ? time_point::max() : timepoint + relative_deadline;
+
+                timers.push_back(entry{deadline, order++, relative_deadline, std::move(schedulable)});
+                std::push_heap(timers.begin(), timers.end(), by_timepoint{});
+            }
+
+            // moves all due timers to ready ones
+            void promote_due(time_point now)
+            {
+                while (!timers.empty() && timers.front().schedulable->get_timepoint() <= now)
+                {
+                    std::pop_heap(timers.begin(), timers.end(), by_timepoint{});
+                    ready.push_back(std::move(timers.back()));
+                    timers.pop_back();
+                    std::push_heap(ready.begin(), ready.end(), by_deadline{});
+                }
+            }
+
+            entry pop_timer()
+            {
+                std::pop_heap(timers.begin(), timers.end(), by_timepoint{});
+                auto res = std::move(timers.back());
+                timers.pop_back();
+                return res;
+            }
+
+            entry pop_ready()
+            {
+                std::pop_heap(ready.begin(), ready.end(), by_deadline{});
+                auto res = std::move(ready.back());
+                ready.pop_back();
+                return res;
+            }
+        };
+
+        class state_t final
+        {
+        public:
+            explicit state_t(options&& opts)
+                : m_data{std::make_shared<queue_data>(std::move(opts))}
+                , m_thread{&data_thread, m_data}
+            {
+            }
+
+            ~state_t() noexcept
+            {
+                if (!m_thread.joinable())
+                    return;
+
+                {
+                    std::lock_guard lock{m_data->mutex};
+                    m_data->is_stoping = true;
+                }
+                m_data->cv.notify_all();
+                m_thread.detach();
+            }
+
+            state_t(const state_t&) = delete;
+            state_t(state_t&&)      = delete;
+
+            template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
+            void defer_to(time_point tp, duration relative_deadline, Fn&& fn, Handler&& handler, Args&&... args)
+            {
+                using schedulable_type = details::specific_schedulable<worker_strategy, std::decay_t<Fn>, std::decay_t<Handler>, std::decay_t<Args>...>;
+
+                details::schedulable_ptr schedulable{new schedulable_type(tp, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...)};
+                {
+                    std::lock_guard lock{m_data->mutex};
+                    m_data->push(std::move(schedulable), relative_deadline);
+                }
+                m_data->cv.notify_one();
+            }
+
+            const options& get_options() const { return m_data->opts; }
+
+            size_t get_missed_count() const { return m_data->missed.load(); }
+
+        private:
+            static void data_thread(std::shared_ptr<queue_data> state)
+            {
+                std::unique_lock lock{state->mutex};
+                while (true)
+                {
+                    state->promote_due(details::now());
+                    if (state->ready.empty())
+                    {
+                        // disposed timer is removed instead of waiting for it, so thread can finish once only disposed ones remain
+                        if (!state->timers.empty() && state->timers.front().schedulable->is_disposed())
+                        {
+                            {
+                                const auto disposed = state->pop_timer();
+                                lock.unlock();
+                                details::instrumentation::on_disposed_skipped(instrumentation::scheduler_kind::edf_thread);
+                            }
+                            lock.lock();
+                            continue;
+                        }
+
+                        if (!state->timers.empty())
+                            state->cv.wait_until(lock, state->timers.front().schedulable->get_timepoint());
+                        else if (state->is_stoping)
+                            break;
+                        else
+                            state->cv.wait(lock);
+                        continue;
+                    }
+
+                    details::instrumentation::on_queue_depth(instrumentation::scheduler_kind::edf_thread, state->ready.size() + state->timers.size());
+                    auto top = state->pop_ready();
+                    lock.unlock();
+
+                    {
+                        // nested `current_thread` schedulings are trampolined and drained right after schedulable
+                        const auto queue_guard = current_thread::own_queue_and_drain_finally_if_not_owned();
+                        execute(*state, top);
+                    }
+
+                    lock.lock();
+                    if (top.schedulable)
+                        state->push(std::move(top.schedulable), top.relative_deadline);
+                }
+            }
+
+            // executes schedulable of entry and keeps it inside of entry only in case of re-schedule
+            static void execute(queue_data& state, entry& top)
+            {
+                auto schedulable = std::move(top.schedulable);
+                if (schedulable->is_disposed())
+                {
+                    details::instrumentation::on_disposed_skipped(instrumentation::scheduler_kind::edf_thread);
+                    return;
+                }
+
+                if (const auto now = details::now(); now > top.deadline)
+                {
+                    const bool dropped = state.opts.policy == miss_policy::drop;
+                    state.missed.fetch_add(1);
+                    if (state.opts.on_deadline_miss)
+                        state.opts.on_deadline_miss(deadline_miss{schedulable->get_timepoint(), top.deadline, now, dropped});
+                    if (dropped)
+                    {
+                        schedulable->on_error(std::make_exception_ptr(rpp::utils::deadline_missed{"Deadline missed"}));
+                        return;
+                    }
+                }
+
+                const details::instrumentation::execution_scope _{instrumentation::scheduler_kind::edf_thread, schedulable->get_timepoint()};
+                if (const auto timepoint = (*schedulable)())
+                {
+                    if (schedulable->is_disposed())
+                        return;
+
+                    schedulable->set_timepoint(timepoint.value());
+                    top.schedulable = std::move(schedulable);
+                }
+            }
+
+        private:
+            std::shared_ptr<queue_data> m_data;
+            std::thread                 m_thread;
+        };
+
+        class worker_strategy
+        {
+        public:
+            worker_strategy(std::shared_ptr<state_t> state, duration relative_deadline)
+                : m_state{std::move(state)}
+                , m_relative_deadline{relative_deadline}
+            {
+            }
+
+            template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
+            void defer_to(time_point tp, Fn&& fn, Handler&& handler, Args&&... args) const
+            {
+                m_state->defer_to(tp, m_relative_deadline, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+            }
+
+            static rpp::schedulers::time_point now() { return details::now(); }
+
+        private:
+            std::shared_ptr<state_t> m_state;
+            duration                 m_relative_deadline;
+        };
+
+    public:
+        edf_thread()
+            : edf_thread{options{}}
+        {
+        }
+
+        explicit edf_thread(options opts)
+            : m_state{std::make_shared<state_t>(std::move(opts))}
+        {
+        }
+
+        /**
+         * @brief Creates worker with relative deadline from `options::deadline`
+         */
+        rpp::schedulers::worker<worker_strategy> create_worker() const
+        {
+            return create_worker(m_state->get_options().deadline);
+        }
+
+        /**
+         * @brief Creates worker whose schedulables have to be started not later than `deadline` after their time_point
+         */
+        rpp::schedulers::worker<worker_strategy> create_worker(duration deadline) const
+        {
+            return rpp::schedulers::worker<worker_strategy>{m_state, deadline};
+        }
+
+        /**
+         * @brief Total amount of schedulables started after their deadline (both dropped and executed ones)
+         */
+        size_t get_missed_count() const { return m_state->get_missed_count(); }
+
+    private:
+        std::shared_ptr<state_t> m_state;
+    };
+} // namespace rpp::schedulers
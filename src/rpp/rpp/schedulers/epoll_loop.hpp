@@ -0,0 +1,170 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/schedulers/fwd.hpp>
+
+#if defined(__linux__)
+
+    #include <rpp/disposables/disposable_wrapper.hpp>
+    #include <rpp/observables/observable.hpp>
+    #include <rpp/schedulers/details/epoll_reactor.hpp>
+    #include <rpp/schedulers/details/worker.hpp>
+
+    #include <memory>
+    #include <stdexcept>
+
+namespace rpp::schedulers::details
+{
+    template<rpp::constraint::observer_of_type<fd_events> TObserver>
+    class epoll_fd_watch_impl final : public epoll_fd_watch
+    {
+    public:
+        epoll_fd_watch_impl(std::weak_ptr<epoll_reactor> reactor, int fd, fd_events events, TObserver&& observer)
+            : epoll_fd_watch{std::move(reactor), fd, events}
+            , m_observer{std::move(observer)}
+        {
+        }
+
+        void on_events(fd_events events) noexcept override
+        {
+            if (!m_observer.is_disposed())
+                m_observer.on_next(events);
+        }
+
+        void on_error(const std::exception_ptr& err) noexcept override { m_observer.on_error(err); }
+
+        void set_upstream(const rpp::disposable_wrapper& d) noexcept { m_observer.set_upstream(d); }
+
+    private:
+        TObserver m_observer;
+    };
+
+    struct epoll_fd_strategy
+    {
+        using value_type                   = fd_events;
+        using optimal_disposables_strategy = rpp::details::observables::fixed_disposables_strategy<1>;
+
+        std::weak_ptr<epoll_reactor> reactor;
+        int                          fd;
+        fd_events                    events;
+
+        template<rpp::constraint::observer_of_type<value_type> TObs>
+        void subscribe(TObs&& observer) const
+        {
+            const auto locked = reactor.lock();
+            if (!locked)
+            {
+                observer.on_error(std::make_exception_ptr(std::logic_error{"epoll_loop is already destroyed"}));
+                return;
+            }
+
+            const auto d   = rpp::disposable_wrapper_impl<epoll_fd_watch_impl<std::decay_t<TObs>>>::make(reactor, fd, events, std::forward<TObs>(observer));
+            auto       ptr = rpp::details::lock_disposable(d);
+            ptr->set_upstream(d.as_weak());
+            locked->watch(std::move(ptr));
+        }
+    };
+} // namespace rpp::schedulers::details
+
+namespace rpp::schedulers
+{
+    /**
+     * @brief Linux-only single-threaded reactor scheduler based on `epoll`. Works like `run_loop`, but also provides readiness events of file descriptors as observables.
+     * @warning You need manually dispatch events for this scheduler in some thread via `dispatch`, `dispatch_if_ready` or `run`.
+     *
+     * @details All timers are multiplexed through single `timerfd` with nanosecond precision, other threads wake up dispatching thread via `eventfd` only when it is blocked. Schedulables and emissions of `observe_fd` observables are executed only by dispatching thread.
+     * While dispatching, queue of this scheduler is used as `current_thread` queue of dispatching thread, so any `current_thread` schedulings are trampolined into this loop instead of recursion.
+     *
+     * @note `#include <rpp/schedulers/epoll_loop.hpp>`: it is not included by `rpp/schedulers.hpp` to avoid pulling system headers of epoll into every translation unit.
+     *
+     * @ingroup schedulers
+     */
+    class epoll_loop final
+    {
+        class worker_strategy
+        {
+        public:
+            worker_strategy(const std::weak_ptr<details::epoll_reactor>& reactor)
+                : m_reactor{reactor}
+            {
+            }
+
+            template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
+            void defer_to(time_point tp, Fn&& fn, Handler&& handler, Args&&... args) const
+            {
+                if (const auto shared = m_reactor.lock())
+                    shared->defer_to(tp, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+            }
+
+            static constexpr bool is_queue_based = true;
+
+            static rpp::schedulers::time_point now() { return details::now(); }
+
+        private:
+            std::weak_ptr<details::epoll_reactor> m_reactor;
+        };
+
+    public:
+        /**
+         * @param timer_slack default timer slack of schedulables: `timerfd` is armed once to serve all schedulables due within this tolerance
+         * @throws std::system_error in case of epoll/eventfd/timerfd can't be created
+         */
+        explicit epoll_loop(duration timer_slack = {})
+            : m_reactor{std::make_shared<details::epoll_reactor>(timer_slack)}
+        {
+        }
+
+        bool is_empty() const { return m_reactor->is_empty(); }
+
+        /**
+         * @brief Processes ready file descriptors and due schedulables without blocking
+         */
+        void dispatch_if_ready() const { m_reactor->dispatch(false); }
+
+        /**
+         * @brief Blocks till some file descriptor or schedulable becomes ready, then processes them
+         */
+        void dispatch() const { m_reactor->dispatch(true); }
+
+        /**
+         * @brief Dispatches events in the current thread till `stop` is called
+         */
+        void run() const { m_reactor->run(); }
+
+        /**
+         * @brief Requests `run` to return. Can be called from any thread.
+         */
+        void stop() const { m_reactor->stop(); }
+
+        rpp::schedulers::worker<worker_strategy> create_worker() const
+        {
+            return rpp::schedulers::worker<worker_strategy>{m_reactor};
+        }
+
+        /**
+         * @brief Creates observable emitting readiness events of provided file descriptor. Emissions happen in the dispatching thread of this loop.
+         * @details Descriptor is level-triggered: event is emitted on each dispatch while descriptor is ready. Observable never completes by itself: `fd_events::error` and `fd_events::hangup` are emitted as regular values. Descriptor is unregistered on dispose, but it is never closed by loop.
+         *
+         * @param fd file descriptor supported by epoll (socket, pipe, eventfd and etc)
+         * @param events events of interest
+         */
+        auto observe_fd(int fd, fd_events events = fd_events::readable) const
+        {
+            return rpp::observable<fd_events, details::epoll_fd_strategy>{m_reactor, fd, events};
+        }
+
+    private:
+        std::shared_ptr<details::epoll_reactor> m_reactor;
+    };
+} // namespace rpp::schedulers
+
+#endif
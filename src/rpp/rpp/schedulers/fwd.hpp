@@ -15,6 +15,7 @@
 #include <rpp/utils/constraints.hpp>
 
 #include <chrono>
+#include <cstdint>
 #include <optional>
 
 namespace rpp::schedulers
@@ -76,6 +77,67 @@ namespace rpp::schedulers
         time_point value;
     };
 
+    /**
+     * @brief Storage used by queue-based schedulers to keep schedulables ordered by time_point. Schedulables with equal time_points are always kept in FIFO order.
+     */
+    enum class queue_backend : uint8_t
+    {
+        // sorted singly linked list: O(1) insertion in front and pop, O(n) insertion otherwise. Fits best for small amount of pending schedulables.
+        linked_list,
+        // 4-ary heap: O(log n) insertion and pop. Fits best for huge amount of pending timers (timeout/debounce/delay and etc).
+        heap
+    };
+
+    /**
+     * @brief Strategy of waiting used by thread of scheduler when it has nothing to execute: busy-spin with cpu `pause` for `spin_count` iterations, then `std::this_thread::yield` for `yield_count` iterations and only then park thread on condition variable.
+     * @details Other threads wake up parked thread via syscall, while spinning thread picks up new schedulables immediately. Default values mean "park immediately". Spinning is useful for latency-sensitive stages with dedicated cores, but burns cpu while idle.
+     */
+    struct idle_strategy
+    {
+        size_t spin_count{};
+        size_t yield_count{};
+    };
+
+    /**
+     * @brief Time slice of schedulable re-scheduling itself with zero delay (`from_iterable`, `repeat`, `interval` with zero period and etc): such schedulable keeps running in place till `iterations` executions are made or `time` is spent, then it is re-queued behind other due schedulables.
+     * @details Zero values mean "no budget": schedulable runs in place only while there is nothing else to execute, and is re-queued after each execution otherwise. Budget makes interleaving of co-located pipelines predictable: each turn is bounded by the budget instead of depending on timing of other submissions.
+     */
+    struct execution_budget
+    {
+        size_t   iterations{};
+        duration time{};
+    };
+
+    /**
+     * @brief Tolerance of timer firing. Queue-based schedulers are allowed to execute schedulable up to `value` later than its time_point to serve close deadlines by the same wake-up of the thread.
+     * @details Scheduler-level slack is configured via options of scheduler and applies to all schedulables of this scheduler. It can be overridden for some schedulable via `worker::schedule(timer_slack, ...)`: for example, `timer_slack{}` keeps timer precise.
+     */
+    struct timer_slack
+    {
+        duration value{};
+    };
+
+    /**
+     * @brief Priority class of schedulable. Among due schedulables of the same queue-based scheduler the ones with higher priority are executed first, schedulables of the same priority are still executed in time_point and FIFO order.
+     * @details Useful to keep control-plane work (disposing, errors, heartbeats) responsive while the same worker is flooded with bulk emissions. Use `starvation_limit` option of scheduler to guarantee progress of lower priorities.
+     */
+    enum class priority : uint8_t
+    {
+        high,
+        normal,
+        low
+    };
+
+    /**
+     * @brief Precision of waiting for time_point of schedulable. By default thread just sleeps (or waits on condition variable) till time_point, which usually overshoots by tens of microseconds. With non-zero `spin_threshold` thread sleeps only till `spin_threshold` before time_point and busy-spins on `clock` for the rest.
+     * @details Trades cpu time for precise timing of sub-millisecond `interval`/`delay` pipelines. `clock` has to return time_points of the same timeline as `clock_type`: for example, clock reading TSC counter calibrated against `clock_type` to make each iteration of spinning cheaper.
+     */
+    struct sleep_precision
+    {
+        duration spin_threshold{};
+        time_point (*clock)() = &clock_type::now;
+    };
+
     using optional_delay_from_now            = std::optional<delay_from_now>;
     using optional_delay_from_this_timepoint = std::optional<delay_from_this_timepoint>;
     using optional_delay_to                  = std::optional<delay_to>;
@@ -149,6 +211,12 @@ namespace rpp::schedulers::constraint
             S::now()
         } -> std::same_as<rpp::schedulers::time_point>;
     };
+
+    /**
+     * @brief Strategy keeps schedulables inside of `schedulables_queue`, so priority and timer slack requested via `worker::schedule` are stored inside of schedulable and respected by the queue. Workers of other strategies don't accept such a requests instead of silently ignoring them.
+     */
+    template<typename S>
+    concept queue_based_strategy = strategy<S> && requires { requires S::is_queue_based; };
 } // namespace rpp::schedulers::constraint
 
 namespace rpp::schedulers
@@ -160,8 +228,15 @@ namespace rpp::schedulers
     class current_thread;
     class new_thread;
     class run_loop;
+#if defined(__linux__)
+    class epoll_loop;
+#endif
     class thread_pool;
     class computational;
+    class strand;
+    class io;
+    class edf_thread;
+    class simulation_scheduler;
 
     namespace defaults
     {
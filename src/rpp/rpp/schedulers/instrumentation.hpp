@@ -0,0 +1,300 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/schedulers/fwd.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <concepts>
+#include <cstdint>
+#include <optional>
+#include <utility>
+
+/**
+ * @brief Define `RPP_SCHEDULERS_INSTRUMENTATION` to `1` (or enable `RPP_ENABLE_SCHEDULERS_INSTRUMENTATION` CMake option) to collect statistics of queue-based schedulers. When disabled, all hooks are empty and cost nothing.
+ */
+#ifndef RPP_SCHEDULERS_INSTRUMENTATION
+    #define RPP_SCHEDULERS_INSTRUMENTATION 0
+#endif
+
+namespace rpp::schedulers::instrumentation
+{
+    /**
+     * @brief Scheduler statistics are collected for. Statistics are aggregated between all instances of the same scheduler: two `run_loop`s (or all threads of `thread_pool`) share the same counters and histograms.
+     */
+    enum class scheduler_kind : uint8_t
+    {
+        current_thread,
+        new_thread,
+        run_loop,
+        thread_pool,
+        epoll_loop,
+        edf_thread,
+        count
+    };
+
+    constexpr bool is_enabled = RPP_SCHEDULERS_INSTRUMENTATION != 0;
+
+    /**
+     * @brief Distribution of durations in power-of-two microseconds buckets: bucket `0` counts durations below 1us, bucket `i` counts durations in range [2^(i-1), 2^i) us, last bucket counts all longer durations.
+     */
+    struct histogram
+    {
+        static constexpr size_t buckets_count = 24;
+
+        std::array<size_t, buckets_count> buckets{};
+        size_t                            count{};
+        duration                          total{};
+        duration                          max{};
+
+        static size_t get_bucket(duration value)
+        {
+            const auto micros = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(std::max(duration::zero(), value)).count());
+            return std::min(static_cast<size_t>(std::bit_width(micros)), buckets_count - 1);
+        }
+
+        void record(duration value)
+        {
+            value = std::max(duration::zero(), value);
+            ++buckets[get_bucket(value)];
+            ++count;
+            total += value;
+            max = std::max(max, value);
+        }
+    };
+
+    /**
+     * @brief Statistics of all instances of some `scheduler_kind`. There are no per-instance statistics, so lag and queue depth of some particular instance can be observed only in case of it is the only instance of its kind.
+     */
+    struct scheduler_statistics
+    {
+        // schedulables executed (including each re-schedule of the same schedulable, even executed in place without returning to the queue)
+        size_t executed{};
+        // schedulables removed from the queue without execution due to being disposed
+        size_t disposed_skipped{};
+        // depth of queue observed by last execution cycle of any instance
+        size_t last_queue_depth{};
+        size_t max_queue_depth{};
+        // delay between expected time_point of schedulable and actual start of its execution (not recorded for re-executions in place)
+        histogram lag{};
+        // duration of each execution of schedulable
+        histogram execution{};
+    };
+} // namespace rpp::schedulers::instrumentation
+
+namespace rpp::schedulers::details::instrumentation
+{
+    using rpp::schedulers::instrumentation::scheduler_kind;
+
+#if RPP_SCHEDULERS_INSTRUMENTATION
+    class atomic_histogram
+    {
+    public:
+        void record(duration value)
+        {
+            value = std::max(duration::zero(), value);
+
+            m_buckets[rpp::schedulers::instrumentation::histogram::get_bucket(value)].fetch_add(1, std::memory_order_relaxed);
+            m_count.fetch_add(1, std::memory_order_relaxed);
+            m_total.fetch_add(value.count(), std::memory_order_relaxed);
+
+            auto max = m_max.load(std::memory_order_relaxed);
+            while (max < value.count() && !m_max.compare_exchange_weak(max, value.count(), std::memory_order_relaxed))
+            {
+            }
+        }
+
+        rpp::schedulers::instrumentation::histogram snapshot() const
+        {
+            rpp::schedulers::instrumentation::histogram res{};
+            for (size_t i = 0; i < m_buckets.size(); ++i)
+                res.buckets[i] = m_buckets[i].load(std::memory_order_relaxed);
+            res.count = m_count.load(std::memory_order_relaxed);
+            res.total = duration{m_total.load(std::memory_order_relaxed)};
+            res.max   = duration{m_max.load(std::memory_order_relaxed)};
+            return res;
+        }
+
+        void reset()
+        {
+            for (auto& bucket : m_buckets)
+                bucket.store(0, std::memory_order_relaxed);
+            m_count.store(0, std::memory_order_relaxed);
+            m_total.store(0, std::memory_order_relaxed);
+            m_max.store(0, std::memory_order_relaxed);
+        }
+
+    private:
+        std::array<std::atomic<size_t>, rpp::schedulers::instrumentation::histogram::buckets_count> m_buckets{};
+        std::atomic<size_t>                                                                        m_count{};
+        std::atomic<duration::rep>                                                                 m_total{};
+        std::atomic<duration::rep>                                                                 m_max{};
+    };
+
+    struct statistics_storage
+    {
+        std::atomic<size_t> executed{};
+        std::atomic<size_t> disposed_skipped{};
+        std::atomic<size_t> last_queue_depth{};
+        std::atomic<size_t> max_queue_depth{};
+        atomic_histogram    lag{};
+        atomic_histogram    execution{};
+    };
+
+    inline statistics_storage& get_storage(scheduler_kind kind)
+    {
+        static std::array<statistics_storage, static_cast<size_t>(scheduler_kind::count)> s_storage{};
+        return s_storage[static_cast<size_t>(kind)];
+    }
+
+    inline void on_queue_depth(scheduler_kind kind, size_t depth)
+    {
+        auto& storage = get_storage(kind);
+        storage.last_queue_depth.store(depth, std::memory_order_relaxed);
+
+        auto max = storage.max_queue_depth.load(std::memory_order_relaxed);
+        while (max < depth && !storage.max_queue_depth.compare_exchange_weak(max, depth, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    inline void on_disposed_skipped(scheduler_kind kind)
+    {
+        get_storage(kind).disposed_skipped.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Records lag of schedulable on construction and duration of its execution on destruction. Schedulable re-executed in place right after previous execution has no expected time_point, so its lag is not recorded.
+     */
+    class execution_scope
+    {
+    public:
+        execution_scope(scheduler_kind kind, std::optional<time_point> expected)
+            : m_storage{get_storage(kind)}
+            , m_start{clock_type::now()}
+        {
+            if (expected)
+                m_storage.lag.record(m_start - expected.value());
+        }
+
+        execution_scope(const execution_scope&) = delete;
+        execution_scope(execution_scope&&)      = delete;
+
+        ~execution_scope() noexcept
+        {
+            m_storage.execution.record(clock_type::now() - m_start);
+            m_storage.executed.fetch_add(1, std::memory_order_relaxed);
+        }
+
+    private:
+        statistics_storage& m_storage;
+        time_point          m_start;
+    };
+
+    /**
+     * @brief Tracks amount of schedulables inside of `schedulables_queue`
+     */
+    class queue_size_counter
+    {
+    public:
+        queue_size_counter() = default;
+
+        queue_size_counter(queue_size_counter&& other) noexcept
+            : m_value{std::exchange(other.m_value, 0)}
+        {
+        }
+
+        queue_size_counter& operator=(queue_size_counter&& other) noexcept
+        {
+            m_value = std::exchange(other.m_value, 0);
+            return *this;
+        }
+
+        void   increment() { ++m_value; }
+        void   decrement() { --m_value; }
+        size_t get() const { return m_value; }
+
+    private:
+        size_t m_value{};
+    };
+#else
+    inline void on_queue_depth(scheduler_kind, size_t) {}
+    inline void on_disposed_skipped(scheduler_kind) {}
+
+    class execution_scope
+    {
+    public:
+        execution_scope(scheduler_kind, std::optional<time_point>) {}
+    };
+
+    struct queue_size_counter
+    {
+        static void             increment() {}
+        static void             decrement() {}
+        static constexpr size_t get() { return 0; }
+    };
+#endif
+
+    /**
+     * @brief Invokes provided function as single execution of schedulable, see `execution_scope`
+     */
+    template<std::invocable Fn>
+    auto record_execution(scheduler_kind kind, std::optional<time_point> expected, Fn&& fn)
+    {
+        const execution_scope _{kind, expected};
+        return fn();
+    }
+} // namespace rpp::schedulers::details::instrumentation
+
+namespace rpp::schedulers::instrumentation
+{
+    /**
+     * @brief Pull API to scrape statistics collected for provided kind of schedulers (aggregated between all its instances).
+     * @returns empty statistics in case of instrumentation is disabled
+     */
+    inline scheduler_statistics get_statistics([[maybe_unused]] scheduler_kind kind)
+    {
+        scheduler_statistics res{};
+#if RPP_SCHEDULERS_INSTRUMENTATION
+        const auto& storage  = details::instrumentation::get_storage(kind);
+        res.executed         = storage.executed.load(std::memory_order_relaxed);
+        res.disposed_skipped = storage.disposed_skipped.load(std::memory_order_relaxed);
+        res.last_queue_depth = storage.last_queue_depth.load(std::memory_order_relaxed);
+        res.max_queue_depth  = storage.max_queue_depth.load(std::memory_order_relaxed);
+        res.lag              = storage.lag.snapshot();
+        res.execution        = storage.execution.snapshot();
+#endif
+        return res;
+    }
+
+    /**
+     * @brief Resets statistics of all schedulers
+     */
+    inline void reset_statistics()
+    {
+#if RPP_SCHEDULERS_INSTRUMENTATION
+        for (size_t i = 0; i < static_cast<size_t>(scheduler_kind::count); ++i)
+        {
+            auto& storage = details::instrumentation::get_storage(static_cast<scheduler_kind>(i));
+            storage.executed.store(0, std::memory_order_relaxed);
+            storage.disposed_skipped.store(0, std::memory_order_relaxed);
+            storage.last_queue_depth.store(0, std::memory_order_relaxed);
+            storage.max_queue_depth.store(0, std::memory_order_relaxed);
+            storage.lag.reset();
+            storage.execution.reset();
+        }
+#endif
+    }
+} // namespace rpp::schedulers::instrumentation
@@ -0,0 +1,270 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/schedulers/fwd.hpp>
+
+#include <rpp/defs.hpp>
+#include <rpp/schedulers/new_thread.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace rpp::schedulers
+{
+    /**
+     * @brief Elastic scheduler for blocking I/O: each worker gets own thread taken from cache of idle threads. Cache grows on demand up to `max_threads` and threads idle longer than `idle_timeout` are retired.
+     * @details Threads are regular `new_thread` workers. Thread is returned to the cache when last copy of worker is destroyed and all schedulables scheduled via this worker are finished, so it is reused by next `create_worker` call without paying thread creation cost. Operators like `subscribe_on` drop worker right after scheduling, so blocking schedulable still keeps its thread till the end and concurrent subscriptions get different threads.
+     * In case of all `max_threads` threads are busy, new worker shares thread with the least amount of workers, so blocking calls of such workers are serialized.
+     *
+     * @par Example
+     * @snippet subscribe_on.cpp io
+     *
+     * @ingroup schedulers
+     */
+    class io final
+    {
+        using original_worker = decltype(new_thread::create_worker());
+
+        struct cached_thread
+        {
+            explicit cached_thread(original_worker&& w)
+                : worker{std::move(w)}
+            {
+            }
+
+            original_worker worker;
+            // amount of alive leases of this thread, guarded by mutex of state
+            size_t leases{};
+            // incremented each time thread becomes idle or busy again, so stale retirement requests are ignored
+            std::atomic<size_t> generation{};
+        };
+
+        class state final : public std::enable_shared_from_this<state>
+        {
+            struct retire_handler
+            {
+                std::weak_ptr<cached_thread> thread;
+                size_t                       generation;
+
+                bool is_disposed() const noexcept
+                {
+                    const auto locked = thread.lock();
+                    return !locked || locked->generation.load() != generation;
+                }
+
+                static void on_error(const std::exception_ptr&) noexcept {}
+            };
+
+        public:
+            state(size_t max_threads, duration idle_timeout)
+                : m_max_threads{std::max(size_t{1}, max_threads)}
+                , m_idle_timeout{idle_timeout}
+            {
+            }
+
+            std::shared_ptr<cached_thread> acquire()
+            {
+                std::lock_guard lock{m_mutex};
+                for (const auto& thread : m_threads)
+                {
+                    if (thread->leases == 0)
+                    {
+                        // pending retirement of this thread is not actual anymore
+                        thread->generation.fetch_add(1);
+                        ++thread->leases;
+                        return thread;
+                    }
+                }
+
+                if (m_threads.size() < m_max_threads)
+                {
+                    auto& thread = m_threads.emplace_back(std::make_shared<cached_thread>(new_thread::create_worker()));
+                    ++thread->leases;
+                    return thread;
+                }
+
+                const auto& thread = *std::min_element(m_threads.begin(), m_threads.end(), [](const auto& l, const auto& r) { return l->leases < r->leases; });
+                ++thread->leases;
+                return thread;
+            }
+
+            void release(const std::shared_ptr<cached_thread>& thread)
+            {
+                size_t generation{};
+                {
+                    std::lock_guard lock{m_mutex};
+                    if (--thread->leases != 0)
+                        return;
+
+                    generation = thread->generation.fetch_add(1) + 1;
+                }
+
+                // retirement check is executed by thread itself, so no any extra thread is needed to track idle ones
+                thread->worker.schedule(
+                    m_idle_timeout,
+                    [](const retire_handler& handler, const std::weak_ptr<state>& weak_state) -> optional_delay_from_now {
+                        if (const auto self = weak_state.lock())
+                            self->retire(handler);
+                        return std::nullopt;
+                    },
+                    retire_handler{thread, generation},
+                    weak_from_this());
+            }
+
+            size_t get_threads_count() const
+            {
+                std::lock_guard lock{m_mutex};
+                return m_threads.size();
+            }
+
+        private:
+            void retire(const retire_handler& handler)
+            {
+                // thread is destroyed out of lock: destruction of worker wakes up thread to finish it
+                std::shared_ptr<cached_thread> retired{};
+
+                std::lock_guard lock{m_mutex};
+                const auto      it = std::find_if(m_threads.begin(), m_threads.end(), [&](const auto& thread) { return thread == handler.thread.lock(); });
+                if (it == m_threads.end() || (*it)->leases != 0 || handler.is_disposed())
+                    return;
+
+                retired = std::move(*it);
+                m_threads.erase(it);
+            }
+
+        private:
+            mutable std::mutex                          m_mutex{};
+            std::vector<std::shared_ptr<cached_thread>> m_threads{};
+            const size_t                                m_max_threads;
+            const duration                              m_idle_timeout;
+        };
+
+        class lease final
+        {
+        public:
+            lease(std::shared_ptr<state> state)
+                : m_state{std::move(state)}
+                , m_thread{m_state->acquire()}
+            {
+            }
+
+            lease(const lease&) = delete;
+            lease(lease&&)      = delete;
+
+            ~lease() noexcept { m_state->release(m_thread); }
+
+            const original_worker& get_worker() const { return m_thread->worker; }
+
+        private:
+            std::shared_ptr<state>         m_state;
+            std::shared_ptr<cached_thread> m_thread;
+        };
+
+        // detaches current_thread from queue of underlying thread, so schedulings via current_thread use own queue drained in place
+        class detached_queue_scope
+        {
+        public:
+            detached_queue_scope()
+                : m_queue{std::exchange(current_thread::get_queue(), nullptr)}
+            {
+            }
+
+            detached_queue_scope(const detached_queue_scope&) = delete;
+            detached_queue_scope(detached_queue_scope&&)      = delete;
+
+            ~detached_queue_scope() noexcept { current_thread::get_queue() = m_queue; }
+
+        private:
+            details::schedulables_queue<current_thread::worker_strategy>* m_queue;
+        };
+
+        // keeps thread leased till schedulable is finished even if worker itself is already destroyed
+        template<typename Fn>
+        struct leased_fn
+        {
+            RPP_NO_UNIQUE_ADDRESS Fn fn;
+            std::shared_ptr<lease>   thread_lease;
+
+            template<typename... Args>
+            auto operator()(Args&... args)
+            {
+                // nested schedulings (like emissions of `just` scheduled via current_thread) are finished before lease is released instead of being postponed to queue of thread
+                const detached_queue_scope scope{};
+                return fn(args...);
+            }
+        };
+
+        class worker_strategy
+        {
+        public:
+            worker_strategy(const std::shared_ptr<state>& state)
+                : m_lease{std::make_shared<lease>(state)}
+            {
+            }
+
+            template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
+            void defer_to(time_point tp, Fn&& fn, Handler&& handler, Args&&... args) const
+            {
+                m_lease->get_worker().schedule(tp, leased_fn<std::decay_t<Fn>>{std::forward<Fn>(fn), m_lease}, std::forward<Handler>(handler), std::forward<Args>(args)...);
+            }
+
+            static constexpr bool is_queue_based = true;
+
+            static rpp::schedulers::time_point now() { return original_worker::now(); }
+
+        private:
+            std::shared_ptr<lease> m_lease;
+        };
+
+    public:
+        struct options
+        {
+            /**
+             * @brief Maximum amount of threads owned by scheduler at the same time
+             */
+            size_t max_threads{256};
+            /**
+             * @brief Thread not used by any worker for this duration is finished
+             */
+            duration idle_timeout{std::chrono::seconds{60}};
+        };
+
+        io()
+            : io{options{}}
+        {
+        }
+
+        explicit io(const options& opts)
+            : m_state{std::make_shared<state>(opts.max_threads, opts.idle_timeout)}
+        {
+        }
+
+        rpp::schedulers::worker<worker_strategy> create_worker() const
+        {
+            return rpp::schedulers::worker<worker_strategy>{m_state};
+        }
+
+        /**
+         * @brief Amount of threads currently owned by scheduler (both used by workers and idle ones)
+         */
+        size_t get_threads_count() const { return m_state->get_threads_count(); }
+
+    private:
+        std::shared_ptr<state> m_state;
+    };
+} // namespace rpp::schedulers
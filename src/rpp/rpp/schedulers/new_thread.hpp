@@ -12,11 +12,15 @@
 
 #include <rpp/disposables/details/base_disposable.hpp>
 #include <rpp/schedulers/current_thread.hpp>
+#include <rpp/schedulers/instrumentation.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <condition_variable>
+#include <functional>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <thread>
 
 namespace rpp::schedulers
@@ -29,10 +33,52 @@ namespace rpp::schedulers
      */
     class new_thread
     {
+    public:
+        struct options
+        {
+            /**
+             * @brief Invoked inside of newly created thread before processing of any schedulable. Useful to configure thread itself: affinity, name, priority and etc.
+             */
+            std::function<void()> on_thread_start{};
+            /**
+             * @brief Strategy of waiting for new schedulables instead of parking immediately
+             */
+            idle_strategy idle{};
+            /**
+             * @brief Default timer slack of schedulables of this worker: thread wakes up once to execute all schedulables due within this tolerance
+             */
+            duration timer_slack{};
+            /**
+             * @brief Maximum amount of higher priority schedulables executed in a row in front of earlier due lower priority one. Zero means strict priority. See `priority`.
+             */
+            size_t starvation_limit{};
+            /**
+             * @brief Precision of waiting for time_point of delayed schedulables. Also applied to `immediate`/`current_thread` schedulings made from this thread.
+             */
+            sleep_precision precision{};
+            /**
+             * @brief Time slice of schedulable re-scheduling itself with zero delay before it is re-queued behind other schedulables
+             */
+            execution_budget budget{};
+            /**
+             * @brief Storage of the queue of schedulables. Use `queue_backend::heap` in case of expected huge amount of pending timers.
+             */
+            queue_backend backend{queue_backend::linked_list};
+            /**
+             * @brief Maximum amount of due schedulables executed in a row before checking for new submissions from other threads. Bigger value means less synchronization overhead under high load, smaller value means lower latency for newly submitted schedulables with earlier time_point.
+             */
+            size_t max_batch_size{1};
+        };
+
+    private:
         class state_t final
         {
         public:
-            state_t() = default;
+            explicit state_t(options opts, instrumentation::scheduler_kind kind)
+                : m_state{std::make_shared<queue_data>(opts.backend, opts.starvation_limit)}
+                , m_thread{&data_thread, m_state, std::move(opts), kind}
+            {
+            }
 
             ~state_t() noexcept
             {
@@ -50,85 +96,194 @@ namespace rpp::schedulers
             template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
             void defer_to(time_point time_point, Fn&& fn, Handler&& handler, Args&&... args)
             {
-                m_state->queue.emplace(time_point, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
-                m_state->has_fresh_data.store(true);
+                // schedule from the thread of this worker itself: queue is owned by this thread, so no any synchronization needed
+                if (current_thread::get_queue() == &m_state->queue)
+                {
+                    m_state->queue.emplace(time_point, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+                    return;
+                }
+
+                m_state->inbox.emplace(time_point, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+                if (m_state->is_parked.load())
+                {
+                    {
+                        std::lock_guard lock{m_state->mutex};
+                    }
+                    m_state->cv.notify_one();
+                }
             }
 
         private:
             struct queue_data : public details::shared_queue_data
             {
-                details::schedulables_queue<current_thread::worker_strategy> queue{};
+                queue_data(queue_backend backend, size_t starvation_limit)
+                    : queue{backend, starvation_limit}
+                {
+                }
+
+                // accessed only by thread of worker
+                details::schedulables_queue<current_thread::worker_strategy> queue;
+                // cross-thread submissions, spliced into queue by thread of worker
+                details::schedulables_inbox<current_thread::worker_strategy> inbox{};
+                std::atomic_bool                                             is_parked{};
                 bool                                                         is_stoping{};
-                std::atomic_bool                                             has_fresh_data{false};
             };
 
-            static void data_thread(std::shared_ptr<queue_data> state)
+            template<typename Predicate>
+            static void park(queue_data& state, std::unique_lock<std::recursive_mutex>& lock, Predicate&& pred)
+            {
+                // producers check this flag after pushing to the inbox, so notification is not lost
+                state.is_parked.store(true);
+                state.cv.wait(lock, std::forward<Predicate>(pred));
+                state.is_parked.store(false);
+            }
+
+            template<typename Predicate>
+            static void park_for(queue_data& state, std::unique_lock<std::recursive_mutex>& lock, duration duration, Predicate&& pred)
             {
+                state.is_parked.store(true);
+                state.cv.wait_for(lock, duration, std::forward<Predicate>(pred));
+                state.is_parked.store(false);
+            }
+
+            static void data_thread(std::shared_ptr<queue_data> state, options opts, instrumentation::scheduler_kind kind)
+            {
+                if (opts.on_thread_start)
+                    opts.on_thread_start();
+
+                const auto idle             = opts.idle;
+                const auto spin_threshold   = std::max(opts.precision.spin_threshold, duration::zero());
+                const auto max_batch_size   = std::max(size_t{1}, opts.max_batch_size);
+                details::s_sleep_precision  = opts.precision;
                 current_thread::get_queue() = &state->queue;
 
                 while (true)
                 {
-                    std::unique_lock lock{state->mutex};
-                    if (state->queue.is_empty() && state->is_stoping)
-                        break;
-
-                    state->cv.wait(lock, [&] { return !state->queue.is_empty() || state->is_stoping; });
+                    state->inbox.splice_to(state->queue);
+                    details::instrumentation::on_queue_depth(kind, state->queue.size());
 
                     if (state->queue.is_empty())
-                        break;
-
-                    if (state->queue.top()->is_disposed())
                     {
-                        state->queue.pop();
+                        // producers don't notify not parked thread, so spinning thread picks up new submissions without any syscalls
+                        if (details::idle_until(idle, [&] { return !state->inbox.is_empty(); }))
+                            continue;
+
+                        std::unique_lock lock{state->mutex};
+                        if (state->is_stoping && state->inbox.is_empty())
+                            break;
+
+                        park(*state, lock, [&] { return !state->inbox.is_empty() || state->is_stoping; });
                         continue;
                     }
 
-                    if (details::s_last_now_time < state->queue.top()->get_timepoint())
+                    if (execute_batch(*state, kind, opts.budget, max_batch_size))
                     {
-                        if (const auto now = worker_strategy::now(); now < state->queue.top()->get_timepoint())
-                        {
-                            state->cv.wait_for(lock, state->queue.top()->get_timepoint() - now, [&] { return state->queue.top()->is_disposed() || worker_strategy::now() >= state->queue.top()->get_timepoint(); });
+                        const auto wakeup_tp = state->queue.get_wakeup_timepoint(opts.timer_slack);
+                        const auto is_ready  = [&] { return !state->inbox.is_empty() || state->queue.top()->is_disposed() || worker_strategy::now() >= wakeup_tp; };
+                        if (details::idle_until(idle, is_ready))
                             continue;
-                        }
+
+                        // close to deadline thread doesn't park at all to avoid oversleeping of condition variable
+                        if (details::spin_until(opts.precision, wakeup_tp, [&] { return !state->inbox.is_empty() || state->queue.top()->is_disposed(); }))
+                            continue;
+
+                        std::unique_lock lock{state->mutex};
+                        park_for(*state, lock, wakeup_tp - spin_threshold - worker_strategy::now(), is_ready);
                     }
+                }
 
-                    auto top = state->queue.pop();
-                    state->has_fresh_data.store(!state->queue.is_empty());
-                    lock.unlock();
+                current_thread::get_queue() = nullptr;
+            }
 
+            // tracks turn of schedulable running in place due to re-scheduling with zero delay
+            class turn_slice
+            {
+            public:
+                explicit turn_slice(const execution_budget& budget)
+                    : m_budget{budget}
+                    , m_is_limited{budget.iterations != 0 || budget.time > duration::zero()}
+                    , m_start{budget.time > duration::zero() ? worker_strategy::now() : time_point{}}
+                {
+                }
+
+                bool can_continue(const queue_data& state)
+                {
+                    if (!m_is_limited)
+                        return state.queue.is_empty() && state.inbox.is_empty();
+
+                    if (m_budget.iterations != 0 && ++m_iterations >= m_budget.iterations)
+                        return false;
+                    return m_budget.time <= duration::zero() || worker_strategy::now() - m_start < m_budget.time;
+                }
+
+            private:
+                const execution_budget& m_budget;
+                const bool              m_is_limited;
+                const time_point        m_start;
+                size_t                  m_iterations{};
+            };
+
+            // executes up to max_batch_size due schedulables without looking into inbox, returns true in case of top schedulable is not due yet
+            static bool execute_batch(queue_data& state, instrumentation::scheduler_kind kind, const execution_budget& budget, size_t max_batch_size)
+            {
+                for (size_t i = 0; i < max_batch_size && !state.queue.is_empty(); ++i)
+                {
+                    if (state.queue.top()->is_disposed())
+                    {
+                        state.queue.pop();
+                        details::instrumentation::on_disposed_skipped(kind);
+                        continue;
+                    }
+
+                    if (!state.queue.is_top_ready() && details::s_last_now_time < state.queue.top()->get_timepoint())
+                    {
+                        if (worker_strategy::now() < state.queue.top()->get_timepoint())
+                            return true;
+                    }
+
+                    auto top      = state.queue.pop();
+                    auto expected = std::optional{top->get_timepoint()};
+
+                    turn_slice slice{budget};
                     while (true)
                     {
-                        if (const auto res = top->make_advanced_call())
+                        // each execution is recorded separately, re-execution in place has no expected time_point
+                        if (const auto res = details::instrumentation::record_execution(kind, std::exchange(expected, std::nullopt), [&] { return top->make_advanced_call(); }))
                         {
                             if (!top->is_disposed())
                             {
-                                if (res->can_run_immediately() && !state->has_fresh_data.load())
+                                if (res->can_run_immediately() && slice.can_continue(state))
                                     continue;
 
                                 const auto tp = top->handle_advanced_call(res.value());
-                                state->queue.emplace(tp, std::move(top));
+                                state.queue.emplace(tp, std::move(top));
                             }
                         }
                         break;
                     }
                 }
-
-                current_thread::get_queue() = nullptr;
+                return false;
             }
 
         private:
-            std::shared_ptr<queue_data> m_state = std::make_shared<queue_data>();
+            std::shared_ptr<queue_data> m_state;
 
-            RPP_CALL_DURING_CONSTRUCTION(m_state->queue = details::schedulables_queue<current_thread::worker_strategy>(m_state));
-
-            std::thread m_thread{&data_thread, m_state};
+            std::thread m_thread;
         };
 
     public:
         class worker_strategy
         {
         public:
-            worker_strategy() = default;
+            worker_strategy()
+                : worker_strategy{options{}}
+            {
+            }
+
+            explicit worker_strategy(options opts, instrumentation::scheduler_kind kind = instrumentation::scheduler_kind::new_thread)
+                : m_state{std::make_shared<state_t>(std::move(opts), kind)}
+            {
+            }
 
             template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
             void defer_to(time_point tp, Fn&& fn, Handler&& handler, Args&&... args) const
@@ -136,15 +291,42 @@ namespace rpp::schedulers
                 m_state->defer_to(tp, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
             }
 
+            static constexpr bool is_queue_based = true;
+
             static rpp::schedulers::time_point now() { return details::now(); }
 
         private:
-            std::shared_ptr<state_t> m_state = std::make_shared<state_t>();
+            std::shared_ptr<state_t> m_state;
         };
 
         static rpp::schedulers::worker<worker_strategy> create_worker()
         {
             return rpp::schedulers::worker<worker_strategy>{};
         }
+
+        /**
+         * @brief Same as `create_worker()`, but provided function is invoked inside of newly created thread before processing of any schedulable.
+         * @details Useful to configure thread itself: affinity, name, priority and etc.
+         */
+        static rpp::schedulers::worker<worker_strategy> create_worker(std::function<void()> on_thread_start)
+        {
+            return rpp::schedulers::worker<worker_strategy>{options{.on_thread_start = std::move(on_thread_start)}};
+        }
+
+        /**
+         * @brief Same as `create_worker()`, but thread of worker waits for new schedulables according to provided idle strategy instead of parking immediately.
+         */
+        static rpp::schedulers::worker<worker_strategy> create_worker(idle_strategy idle)
+        {
+            return rpp::schedulers::worker<worker_strategy>{options{.idle = idle}};
+        }
+
+        /**
+         * @brief Same as `create_worker()`, but thread of worker is configured via provided options.
+         */
+        static rpp::schedulers::worker<worker_strategy> create_worker(options opts)
+        {
+            return rpp::schedulers::worker<worker_strategy>{std::move(opts)};
+        }
     };
 } // namespace rpp::schedulers
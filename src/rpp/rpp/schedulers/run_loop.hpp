@@ -19,6 +19,12 @@
 #include <rpp/schedulers/details/worker.hpp>
 #include <rpp/utils/functors.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <utility>
+
 namespace rpp::schedulers
 {
     /**
@@ -34,6 +40,12 @@ namespace rpp::schedulers
         class state_t final : public rpp::details::base_disposable
         {
         public:
+            state_t(queue_backend backend, duration timer_slack, size_t starvation_limit)
+                : m_queue{backend, starvation_limit}
+                , m_timer_slack{timer_slack}
+            {
+            }
+
             ~state_t() noexcept override { dispose(); }
 
             template<typename... Args>
@@ -42,58 +54,121 @@ namespace rpp::schedulers
                 if (is_disposed())
                     return;
 
+                // dispose can happen between check and increment, so disposal is checked again to undo own increment. Dispose never resets counter, so undo can't underflow it.
+                m_pending.fetch_add(1);
+                if (is_disposed())
                 {
-                    std::lock_guard lock{m_mutex};
-                    m_queue.emplace(timepoint, std::forward<Args>(args)...);
+                    m_pending.fetch_sub(1, std::memory_order_relaxed);
+                    return;
+                }
+
+                m_inbox.emplace(timepoint, std::forward<Args>(args)...);
+                if (m_is_parked.load())
+                {
+                    {
+                        std::lock_guard lock{m_mutex};
+                    }
+                    m_cv.notify_one();
                 }
-                m_cv.notify_one();
             }
 
-            std::shared_ptr<details::schedulable_base> pop(bool wait)
+            // takes up to max_count due schedulables under single lock
+            details::schedulables_fifo pop_batch(bool wait, size_t max_count)
             {
+                details::schedulables_fifo res{};
                 while (!is_disposed())
                 {
                     std::unique_lock lock{m_mutex};
-                    m_cv.wait(lock, [&] { return !wait || is_disposed() || !m_queue.is_empty(); });
+                    m_inbox.splice_to(m_queue);
+                    details::instrumentation::on_queue_depth(instrumentation::scheduler_kind::run_loop, m_queue.size());
+                    if (m_queue.is_empty())
+                    {
+                        if (!wait)
+                            break;
+
+                        park(lock, [&] { return is_disposed() || !m_inbox.is_empty(); });
+                        continue;
+                    }
 
-                    if (is_disposed())
+                    if (m_queue.is_top_ready())
+                    {
+                        take_ready_unsafe(res, max_count, m_queue.top()->get_timepoint());
                         break;
+                    }
 
                     const auto now = worker_strategy::now();
                     if (is_any_ready_schedulable_unsafe(now))
-                        return m_queue.pop();
+                    {
+                        take_ready_unsafe(res, max_count, now);
+                        break;
+                    }
 
                     if (!wait)
                         break;
 
-                    m_cv.wait_for(lock, m_queue.top()->get_timepoint() - now, [&]() { return is_disposed() || !m_queue.is_empty() || m_queue.top()->get_timepoint() <= worker_strategy::now(); });
+                    const auto wakeup_tp = m_queue.get_wakeup_timepoint(m_timer_slack);
+                    park_for(lock, wakeup_tp - now, [&]() { return is_disposed() || !m_inbox.is_empty() || wakeup_tp <= worker_strategy::now(); });
                 }
-                return {};
+                return res;
             }
 
             bool is_any_ready_schedulable()
             {
                 std::lock_guard lock{m_mutex};
+                m_inbox.splice_to(m_queue);
                 return is_any_ready_schedulable_unsafe();
             }
 
+            // amount of schedulables submitted to the loop and not taken for execution yet (including not due ones)
+            size_t get_pending_count() const { return is_disposed() ? 0 : m_pending.load(std::memory_order_relaxed); }
+
             bool is_empty()
             {
                 std::lock_guard lock{m_mutex};
-                return m_queue.is_empty();
+                return m_queue.is_empty() && m_inbox.is_empty();
             }
 
         private:
+            void take_ready_unsafe(details::schedulables_fifo& res, size_t max_count, time_point now)
+            {
+                for (size_t i = 0; i < max_count && !m_queue.is_empty(); ++i)
+                {
+                    if (!m_queue.is_top_ready() && !m_queue.top()->is_disposed() && m_queue.top()->get_timepoint() > now)
+                        break;
+
+                    res.push_back(m_queue.pop());
+                    m_pending.fetch_sub(1, std::memory_order_relaxed);
+                }
+            }
+
             bool is_any_ready_schedulable_unsafe(time_point now = worker_strategy::now()) const
             {
-                return !m_queue.is_empty() && (m_queue.top()->is_disposed() || m_queue.top()->get_timepoint() <= now);
+                return m_queue.is_top_ready() || (!m_queue.is_empty() && (m_queue.top()->is_disposed() || m_queue.top()->get_timepoint() <= now));
+            }
+
+            // producers check parked flag after pushing to the inbox, so they notify only when it is really needed and notification is not lost
+            template<typename Predicate>
+            void park(std::unique_lock<std::mutex>& lock, Predicate&& pred)
+            {
+                m_is_parked.store(true);
+                m_cv.wait(lock, std::forward<Predicate>(pred));
+                m_is_parked.store(false);
+            }
+
+            template<typename Predicate>
+            void park_for(std::unique_lock<std::mutex>& lock, duration duration, Predicate&& pred)
+            {
+                m_is_parked.store(true);
+                m_cv.wait_for(lock, duration, std::forward<Predicate>(pred));
+                m_is_parked.store(false);
             }
 
             void base_dispose_impl(interface_disposable::Mode) noexcept override
             {
                 {
                     std::lock_guard lock{m_mutex};
-                    m_queue = details::schedulables_queue<worker_strategy>{};
+                    m_queue = details::schedulables_queue<worker_strategy>{m_queue.get_backend(), m_queue.get_starvation_limit()};
+                    m_inbox.clear();
                 }
                 m_cv.notify_one();
             }
@@ -101,8 +176,12 @@ namespace rpp::schedulers
         private:
             std::mutex                                   m_mutex{};
             details::schedulables_queue<worker_strategy> m_queue{};
+            details::schedulables_inbox<worker_strategy> m_inbox{};
 
             std::condition_variable m_cv{};
+            std::atomic_bool        m_is_parked{};
+            std::atomic<size_t>     m_pending{};
+            duration                m_timer_slack;
         };
 
         class worker_strategy
@@ -120,6 +199,9 @@ namespace rpp::schedulers
                     shared->emplace_and_notify(tp, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
             }
 
+            static constexpr bool is_queue_based = true;
+            static constexpr bool is_real_clock  = true;
+
             static rpp::schedulers::time_point now() { return details::now(); }
 
         private:
@@ -127,6 +209,47 @@ namespace rpp::schedulers
         };
 
     public:
+        struct options
+        {
+            /**
+             * @brief Storage of the queue of schedulables. Use `queue_backend::heap` in case of expected huge amount of pending timers.
+             */
+            queue_backend backend{queue_backend::linked_list};
+            /**
+             * @brief Maximum amount of due schedulables taken under single lock and executed by one `dispatch`/`dispatch_if_ready` call. Bigger value means less synchronization overhead under high load, smaller value means lower latency for newly submitted schedulables with earlier time_point.
+             */
+            size_t max_batch_size{1};
+            /**
+             * @brief Default timer slack of schedulables: blocking `dispatch` wakes up once to serve all schedulables due within this tolerance
+             */
+            duration timer_slack{};
+            /**
+             * @brief Maximum amount of higher priority schedulables executed in a row in front of earlier due lower priority one. Zero means strict priority. See `priority`.
+             */
+            size_t starvation_limit{};
+        };
+
+        run_loop()
+            : run_loop{options{}}
+        {
+        }
+
+        /**
+         * @param backend storage of the queue of schedulables. Use `queue_backend::heap` in case of expected huge amount of pending timers.
+         * @param max_batch_size maximum amount of due schedulables taken under single lock and executed by one `dispatch`/`dispatch_if_ready` call.
+         * @param timer_slack default timer slack of schedulables
+         */
+        explicit run_loop(queue_backend backend, size_t max_batch_size = 1, duration timer_slack = {})
+            : run_loop{options{backend, max_batch_size, timer_slack}}
+        {
+        }
+
+        explicit run_loop(const options& opts)
+            : m_state{std::make_shared<state_t>(opts.backend, opts.timer_slack, opts.starvation_limit)}
+            , m_max_batch_size{std::max(size_t{1}, opts.max_batch_size)}
+        {
+        }
+
         bool is_empty() const
         {
             return m_state->is_empty();
@@ -139,12 +262,54 @@ namespace rpp::schedulers
 
         void dispatch_if_ready() const
         {
-            dispatch_impl(false);
+            dispatch_impl(false, m_max_batch_size);
         }
 
         void dispatch() const
         {
-            dispatch_impl(true);
+            dispatch_impl(true, m_max_batch_size);
+        }
+
+        struct dispatch_result
+        {
+            // amount of schedulables executed (disposed ones are not counted)
+            size_t executed{};
+            // amount of schedulables left in the loop, including not due ones
+            size_t remaining{};
+        };
+
+        /**
+         * @brief Default amount of schedulables taken under single lock by `dispatch_until`/`dispatch_for`
+         */
+        static constexpr size_t default_dispatch_batch_size = 64;
+
+        /**
+         * @brief Executes ready schedulables till provided time_point without blocking.
+         * @details Schedulables are taken by batches of up to `batch_size` under single lock and clock is checked once per batch, so `batch_size` bounds both the synchronization overhead and the possible overrun of the deadline. Batch size doesn't depend on `max_batch_size` option used by `dispatch`. Useful to cap amount of reactive work per frame of an external loop.
+         */
+        dispatch_result dispatch_until(time_point deadline, size_t batch_size = default_dispatch_batch_size) const
+        {
+            batch_size = std::max(size_t{1}, batch_size);
+
+            dispatch_result res{};
+            while (worker_strategy::now() < deadline)
+            {
+                const auto executed = dispatch_impl(false, batch_size);
+                if (executed.second == 0)
+                    break;
+
+                res.executed += executed.first;
+            }
+            res.remaining = m_state->get_pending_count();
+            return res;
+        }
+
+        /**
+         * @brief Same as `dispatch_until(now() + budget, batch_size)`
+         */
+        dispatch_result dispatch_for(duration budget, size_t batch_size = default_dispatch_batch_size) const
+        {
+            return dispatch_until(worker_strategy::now() + budget, batch_size);
         }
 
         rpp::schedulers::worker<worker_strategy> create_worker() const
@@ -153,19 +318,32 @@ namespace rpp::schedulers
         }
 
     private:
-        void dispatch_impl(bool wait) const
+        // returns amount of executed schedulables and amount of schedulables taken from the queue
+        std::pair<size_t, size_t> dispatch_impl(bool wait, size_t max_batch_size) const
         {
-            if (auto top = m_state->pop(wait))
+            std::pair<size_t, size_t> res{};
+
+            auto batch = m_state->pop_batch(wait, max_batch_size);
+            while (!batch.empty())
             {
+                ++res.second;
+                auto top = batch.pop_front();
                 if (top->is_disposed())
-                    return;
+                {
+                    details::instrumentation::on_disposed_skipped(instrumentation::scheduler_kind::run_loop);
+                    continue;
+                }
 
+                ++res.first;
+                const details::instrumentation::execution_scope _{instrumentation::scheduler_kind::run_loop, top->get_timepoint()};
                 if (const auto timepoint = (*top)())
                     m_state->emplace_and_notify(timepoint.value(), std::move(top));
             }
+            return res;
         }
 
     private:
-        std::shared_ptr<state_t> m_state = std::make_shared<state_t>();
+        std::shared_ptr<state_t> m_state;
+        size_t                   m_max_batch_size;
     };
 } // namespace rpp::schedulers
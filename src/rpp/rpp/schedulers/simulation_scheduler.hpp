@@ -0,0 +1,407 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/schedulers/fwd.hpp>
+
+#include <rpp/schedulers/details/queue.hpp>
+#include <rpp/schedulers/details/worker.hpp>
+#include <rpp/schedulers/instrumentation.hpp>
+
+#include <algorithm>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace rpp::schedulers
+{
+    /**
+     * @brief Single-threaded virtual-time scheduler for load simulation and capacity testing. Virtual clock jumps directly to the next deadline, so hours of timeline are replayed as fast as schedulables themselves can be executed.
+     * @details Each `create_worker` call creates new simulated worker (like separate thread of `new_thread`): schedulables of the same worker are executed serially in time_point and FIFO order. In case of non-zero `execution_cost` each execution occupies its worker for this virtual duration, so schedulables due while worker is busy are delayed and this queueing is reported as simulated latency.
+     * Nothing is executed till `run`, `run_until` or `run_for` is called. Individual events are recorded only in case of `options::record_events`, otherwise only aggregated statistics are collected.
+     * Each simulation has own virtual clock, so several simulations can be used by the same thread at the same time. Workers convert delays to time_points via clock of own simulation. Static `now()` of worker (used by operators) reports clock of the simulation executing current schedulable, and outside of execution it reports clock of the simulation which created worker last in this thread.
+     * Id of destroyed worker is reused by next created worker as soon as all schedulables of destroyed worker are gone.
+     *
+     * @ingroup schedulers
+     */
+    class simulation_scheduler final
+    {
+    public:
+        struct options
+        {
+            /**
+             * @brief Virtual time_point simulation starts from
+             */
+            time_point start{};
+            /**
+             * @brief Virtual duration each execution of schedulable occupies its worker for
+             */
+            duration execution_cost{};
+            /**
+             * @brief Record each execution to `get_events()`
+             */
+            bool record_events{};
+        };
+
+        struct event
+        {
+            size_t     worker_id{};
+            time_point scheduled{};
+            time_point executed{};
+        };
+
+        struct statistics
+        {
+            // schedulables submitted to workers (including each re-schedule of the same schedulable)
+            size_t scheduled{};
+            // schedulables executed (including each re-schedule of the same schedulable)
+            size_t executed{};
+            // schedulables removed from the queue without execution due to being disposed
+            size_t disposed_skipped{};
+            // maximum amount of pending schedulables of all workers
+            size_t max_queue_depth{};
+            // virtual time elapsed since start of simulation
+            duration simulated_time{};
+            // delay between expected time_point of schedulable and its virtual execution
+            instrumentation::histogram latency{};
+
+            /**
+             * @brief Executions per second of virtual time
+             */
+            double get_throughput() const
+            {
+                const auto seconds = std::chrono::duration<double>(simulated_time).count();
+                return seconds > 0 ? static_cast<double>(executed) / seconds : 0.0;
+            }
+        };
+
+    private:
+        class worker_strategy;
+
+        struct worker_state
+        {
+            // due schedulables waiting for busy worker, in order of their time_points
+            details::schedulables_fifo backlog{};
+            time_point                 busy_until{};
+            // entries in pending heap and backlog (including currently processed one)
+            size_t pending_count{};
+            bool   is_wakeup_pending{};
+            bool   is_released{};
+        };
+
+        // empty schedulable means wake-up of worker to execute its backlog
+        struct pending_entry
+        {
+            time_point               timepoint;
+            size_t                   order;
+            size_t                   worker_id;
+            details::schedulable_ptr schedulable;
+
+            bool operator>(const pending_entry& other) const
+            {
+                return timepoint > other.timepoint || (timepoint == other.timepoint && order > other.order);
+            }
+        };
+
+        class state
+        {
+        public:
+            explicit state(const options& opts)
+                : m_options{opts}
+                , m_now{opts.start}
+            {
+            }
+
+            state(const state&) = delete;
+            state(state&&)      = delete;
+
+            ~state() noexcept
+            {
+                if (s_last_created == this)
+                    s_last_created = nullptr;
+            }
+
+            // clock of the simulation executing current schedulable or created worker last in this thread
+            static time_point get_current_time()
+            {
+                if (const auto* current = s_executing ? s_executing : s_last_created)
+                    return current->m_now;
+                return time_point{};
+            }
+
+            time_point now() const { return m_now; }
+
+            size_t add_worker()
+            {
+                s_last_created = this;
+                if (m_free_workers.empty())
+                {
+                    m_workers.emplace_back();
+                    return m_workers.size() - 1;
+                }
+
+                const auto worker_id = m_free_workers.back();
+                m_free_workers.pop_back();
+                m_workers[worker_id] = worker_state{};
+                return worker_id;
+            }
+
+            void release_worker(size_t worker_id)
+            {
+                m_workers[worker_id].is_released = true;
+                recycle_if_unused(worker_id);
+            }
+
+            template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, rpp::schedulers::constraint::schedulable_fn<Handler, Args...> Fn>
+            void schedule(size_t worker_id, time_point timepoint, Fn&& fn, Handler&& handler, Args&&... args)
+            {
+                using schedulable_type = details::specific_schedulable<worker_strategy, std::decay_t<Fn>, std::decay_t<Handler>, std::decay_t<Args>...>;
+
+                timepoint = std::max(timepoint, m_now);
+                push(timepoint, worker_id, details::schedulable_ptr{new schedulable_type(timepoint, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...)});
+                ++m_statistics.scheduled;
+                ++m_queue_depth;
+                m_statistics.max_queue_depth = std::max(m_statistics.max_queue_depth, m_queue_depth);
+            }
+
+            void run_until(time_point deadline)
+            {
+                while (!m_pending.empty() && m_pending.front().timepoint <= deadline)
+                {
+                    std::pop_heap(m_pending.begin(), m_pending.end(), std::greater<>{});
+                    auto entry = std::move(m_pending.back());
+                    m_pending.pop_back();
+
+                    m_now        = std::max(m_now, entry.timepoint);
+                    auto& worker = m_workers[entry.worker_id];
+
+                    if (!entry.schedulable)
+                    {
+                        worker.is_wakeup_pending = false;
+                        execute(entry.worker_id, worker.backlog.pop_front());
+                        --worker.pending_count;
+                    }
+                    else if (worker.busy_until > m_now || !worker.backlog.empty())
+                    {
+                        worker.backlog.push_back(std::move(entry.schedulable));
+                        ++worker.pending_count;
+                    }
+                    else
+                    {
+                        execute(entry.worker_id, std::move(entry.schedulable));
+                    }
+
+                    if (!worker.backlog.empty() && !worker.is_wakeup_pending)
+                    {
+                        worker.is_wakeup_pending = true;
+                        push(std::max(worker.busy_until, m_now), entry.worker_id, {});
+                    }
+
+                    --worker.pending_count;
+                    recycle_if_unused(entry.worker_id);
+                }
+                m_now = std::max(m_now, deadline);
+            }
+
+            bool is_empty() const { return m_pending.empty(); }
+
+            std::optional<time_point> get_next_timepoint() const
+            {
+                if (m_pending.empty())
+                    return std::nullopt;
+                return m_pending.front().timepoint;
+            }
+
+            statistics get_statistics() const
+            {
+                auto res           = m_statistics;
+                res.simulated_time = m_now - m_options.start;
+                return res;
+            }
+
+            const std::vector<event>& get_events() const { return m_events; }
+
+        private:
+            void push(time_point timepoint, size_t worker_id, details::schedulable_ptr&& schedulable)
+            {
+                m_pending.push_back(pending_entry{timepoint, m_order++, worker_id, std::move(schedulable)});
+                std::push_heap(m_pending.begin(), m_pending.end(), std::greater<>{});
+                ++m_workers[worker_id].pending_count;
+            }
+
+            void recycle_if_unused(size_t worker_id)
+            {
+                const auto& worker = m_workers[worker_id];
+                if (worker.is_released && worker.pending_count == 0)
+                    m_free_workers.push_back(worker_id);
+            }
+
+            void execute(size_t worker_id, details::schedulable_ptr&& schedulable)
+            {
+                --m_queue_depth;
+                if (schedulable->is_disposed())
+                {
+                    ++m_statistics.disposed_skipped;
+                    return;
+                }
+
+                ++m_statistics.executed;
+                m_statistics.latency.record(m_now - schedulable->get_timepoint());
+                if (m_options.record_events)
+                    m_events.push_back(event{worker_id, schedulable->get_timepoint(), m_now});
+
+                m_workers[worker_id].busy_until = m_now + m_options.execution_cost;
+
+                const auto* previous  = std::exchange(s_executing, this);
+                const auto  timepoint = (*schedulable)();
+                s_executing           = previous;
+
+                if (timepoint)
+                {
+                    if (schedulable->is_disposed())
+                        return;
+
+                    const auto next = std::max(m_now, timepoint.value());
+                    schedulable->set_timepoint(next);
+                    push(next, worker_id, std::move(schedulable));
+                    ++m_statistics.scheduled;
+                    ++m_queue_depth;
+                    m_statistics.max_queue_depth = std::max(m_statistics.max_queue_depth, m_queue_depth);
+                }
+            }
+
+        private:
+            options                    m_options;
+            std::deque<worker_state>   m_workers{};
+            std::vector<size_t>        m_free_workers{};
+            std::vector<pending_entry> m_pending{};
+            size_t                     m_order{};
+            size_t                     m_queue_depth{};
+            statistics                 m_statistics{};
+            std::vector<event>         m_events{};
+            time_point                 m_now;
+
+            static inline thread_local const state* s_executing{};
+            static inline thread_local const state* s_last_created{};
+        };
+
+        // shared by all copies of worker to release its slot when the last of them is destroyed
+        class worker_handle
+        {
+        public:
+            worker_handle(std::weak_ptr<state> state, size_t worker_id)
+                : m_state{std::move(state)}
+                , m_worker_id{worker_id}
+            {
+            }
+
+            worker_handle(const worker_handle&) = delete;
+            worker_handle(worker_handle&&)      = delete;
+
+            ~worker_handle() noexcept
+            {
+                if (const auto locked = m_state.lock())
+                    locked->release_worker(m_worker_id);
+            }
+
+            std::shared_ptr<state> lock() const { return m_state.lock(); }
+            size_t                 get_id() const { return m_worker_id; }
+
+        private:
+            std::weak_ptr<state> m_state;
+            size_t               m_worker_id;
+        };
+
+        class worker_strategy
+        {
+        public:
+            worker_strategy(const std::shared_ptr<state>& state, size_t worker_id)
+                : m_handle{std::make_shared<worker_handle>(state, worker_id)}
+            {
+            }
+
+            template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, rpp::schedulers::constraint::schedulable_fn<Handler, Args...> Fn>
+            void defer_for(duration delay, Fn&& fn, Handler&& handler, Args&&... args) const
+            {
+                if (const auto locked = m_handle->lock())
+                    locked->schedule(m_handle->get_id(), locked->now() + delay, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+            }
+
+            template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, rpp::schedulers::constraint::schedulable_fn<Handler, Args...> Fn>
+            void defer_to(time_point tp, Fn&& fn, Handler&& handler, Args&&... args) const
+            {
+                if (const auto locked = m_handle->lock())
+                    locked->schedule(m_handle->get_id(), tp, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+            }
+
+            static rpp::schedulers::time_point now() { return state::get_current_time(); }
+
+        private:
+            std::shared_ptr<worker_handle> m_handle;
+        };
+
+    public:
+        simulation_scheduler()
+            : simulation_scheduler{options{}}
+        {
+        }
+
+        explicit simulation_scheduler(const options& opts)
+            : m_state{std::make_shared<state>(opts)}
+        {
+        }
+
+        /**
+         * @brief Creates new simulated worker. Each worker executes its schedulables serially.
+         */
+        rpp::schedulers::worker<worker_strategy> create_worker() const
+        {
+            return rpp::schedulers::worker<worker_strategy>{m_state, m_state->add_worker()};
+        }
+
+        /**
+         * @brief Current virtual time_point of this simulation
+         */
+        rpp::schedulers::time_point now() const { return m_state->now(); }
+
+        /**
+         * @brief Executes all schedulables due till provided virtual time_point and moves virtual clock to it
+         */
+        void run_until(time_point deadline) const { m_state->run_until(deadline); }
+
+        void run_for(duration dur) const { run_until(now() + dur); }
+
+        /**
+         * @brief Executes schedulables till nothing is pending anymore.
+         * @warning Never returns in case of infinite sources like `interval` without limiting operators.
+         */
+        void run() const
+        {
+            while (const auto tp = m_state->get_next_timepoint())
+                m_state->run_until(tp.value());
+        }
+
+        bool is_empty() const { return m_state->is_empty(); }
+
+        statistics get_statistics() const { return m_state->get_statistics(); }
+
+        /**
+         * @brief Executions recorded in case of `options::record_events`
+         */
+        const std::vector<event>& get_events() const { return m_state->get_events(); }
+
+    private:
+        std::shared_ptr<state> m_state;
+    };
+} // namespace rpp::schedulers
@@ -0,0 +1,66 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/schedulers/fwd.hpp>
+
+#include <rpp/schedulers/thread_pool.hpp>
+
+#include <thread>
+#include <utility>
+
+namespace rpp::schedulers
+{
+    /**
+     * @brief Scheduler multiplexing any amount of lightweight serial queues ("strands") over shared set of threads.
+     * @details Each `create_worker` call creates new strand: schedulables of the same strand are executed in time_point order and never by two threads at the same time, but each strand is executed by any free thread of the pool. As a result, long-running schedulable blocks only its own strand, not other strands sharing the same thread.
+     * Strand costs no thread and no any resource of the pool while it has nothing to execute, so it is fine to create strand per session/connection.
+     *
+     * Unlike `rppasio::schedulers::strand` it doesn't require asio: threads are owned by scheduler itself (`thread_pool` in `thread_pool::mode::work_stealing` mode).
+     * @warning Expected to use this scheduler as local variable to share same threads between different operators or as static variable
+     *
+     * @par Examples
+     * @snippet thread_pool.cpp strand
+     *
+     * @ingroup schedulers
+     */
+    class strand final
+    {
+    public:
+        explicit strand(size_t threads_count = std::thread::hardware_concurrency())
+            : m_pool{threads_count, thread_pool::mode::work_stealing}
+        {
+        }
+
+        /**
+         * @brief Configures threads of the strand via `thread_pool::options`. `pool_mode` is ignored.
+         */
+        explicit strand(thread_pool::options opts)
+            : m_pool{with_work_stealing(std::move(opts))}
+        {
+        }
+
+        auto create_worker() const
+        {
+            return m_pool.create_worker();
+        }
+
+    private:
+        static thread_pool::options with_work_stealing(thread_pool::options opts)
+        {
+            opts.pool_mode = thread_pool::mode::work_stealing;
+            return opts;
+        }
+
+    private:
+        thread_pool m_pool;
+    };
+} // namespace rpp::schedulers
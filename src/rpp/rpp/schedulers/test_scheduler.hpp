@@ -81,6 +81,8 @@ namespace rpp::schedulers
                 }
             }
 
+            static constexpr bool is_queue_based = true;
+
             static rpp::schedulers::time_point now() { return s_current_time; }
 
         private:
@@ -12,8 +12,14 @@
 
 #include <rpp/schedulers/fwd.hpp>
 
+#include <rpp/schedulers/details/thread_placement.hpp>
+#include <rpp/schedulers/details/work_stealing_pool.hpp>
 #include <rpp/schedulers/new_thread.hpp>
 
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <variant>
 #include <vector>
 
 namespace rpp::schedulers
@@ -22,8 +28,16 @@ namespace rpp::schedulers
      * @brief Scheduler owning static thread pool of workers and using "some" thread from this pool on `create_worker` call
      * @warning Expected to use this scheduler as local variable to share same threads between different operators or as static variable
      *
+     * @details Pool can work in two modes:
+     * - `thread_pool::mode::pinned` (default) - each worker is pinned to one thread of the pool (via round-robin). As a result, long-running schedulable of one worker blocks all other workers pinned to the same thread.
+     * - `thread_pool::mode::work_stealing` - each worker is serial queue which is executed by any free thread of the pool. Each thread has own local deque of ready workers and idle threads steal ready workers from busy ones. Schedulables of the same worker are still executed serially and in time_point order.
+     *
+     * Placement of threads can be controlled via `thread_pool::options`: cpu affinity per thread, distribution of threads between NUMA nodes and names of threads. In `pinned` mode `create_worker` prefers threads placed on NUMA node of the calling thread.
+     *
      * @par Examples
      * @snippet thread_pool.cpp thread_pool
+     * @snippet thread_pool.cpp work_stealing
+     * @snippet thread_pool.cpp thread_pool_options
      *
      * @ingroup schedulers
      */
@@ -35,31 +49,82 @@ namespace rpp::schedulers
         {
         public:
             worker_strategy(const original_worker& original_worker)
-                : m_original_worker{original_worker}
+                : m_worker{original_worker}
             {
             }
 
-            template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
-            void defer_for(duration duration, Fn&& fn, Handler&& handler, Args&&... args) const
+            worker_strategy(std::shared_ptr<details::serial_queue> queue)
+                : m_worker{std::move(queue)}
             {
-                m_original_worker.schedule(duration, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
             }
 
             template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
             void defer_to(time_point tp, Fn&& fn, Handler&& handler, Args&&... args) const
             {
-                m_original_worker.schedule(tp, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+                if (const auto* queue = std::get_if<std::shared_ptr<details::serial_queue>>(&m_worker))
+                    (*queue)->defer_to(tp, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+                else
+                    std::get<original_worker>(m_worker).schedule(tp, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
             }
 
+            static constexpr bool is_queue_based = true;
+
             static rpp::schedulers::time_point now() { return original_worker::now(); }
 
         private:
-            original_worker m_original_worker;
+            std::variant<original_worker, std::shared_ptr<details::serial_queue>> m_worker;
         };
 
     public:
-        explicit thread_pool(size_t threads_count = std::thread::hardware_concurrency())
-            : m_state{std::make_shared<state>(threads_count)}
+        /**
+         * @brief Strategy of distributing workers between threads of the pool
+         */
+        enum class mode : uint8_t
+        {
+            pinned,
+            work_stealing
+        };
+
+        /**
+         * @brief Full set of parameters of the pool
+         */
+        struct options
+        {
+            size_t threads_count{std::thread::hardware_concurrency()};
+            mode   pool_mode{mode::pinned};
+            /**
+             * @brief i-th thread is restricted to cpus `affinity[i % affinity.size()]`. Empty means no any restriction. Linux only.
+             */
+            std::vector<std::vector<size_t>> affinity{};
+            /**
+             * @brief Distribute threads between NUMA nodes in round-robin manner and restrict each thread to cpus of its node. Ignored if `affinity` is provided. Linux only.
+             */
+            bool numa_aware{};
+            /**
+             * @brief Threads are named as `thread_name_prefix + index`. Empty means threads are not named.
+             */
+            std::string thread_name_prefix{};
+            /**
+             * @brief Strategy of waiting for new schedulables used by idle threads of the pool
+             */
+            idle_strategy idle{};
+            /**
+             * @brief Default timer slack of schedulables: threads wake up once to execute all schedulables due within this tolerance
+             */
+            duration timer_slack{};
+            /**
+             * @brief Maximum amount of higher priority schedulables executed in a row in front of earlier due lower priority one by the same worker. Zero means strict priority. Applied to `mode::pinned` only.
+             */
+            size_t starvation_limit{};
+        };
+
+        explicit thread_pool(size_t threads_count = std::thread::hardware_concurrency(), mode pool_mode = mode::pinned)
+            : thread_pool{options{threads_count, pool_mode}}
+        {
+        }
+
+        explicit thread_pool(const options& opts)
+            : m_state{std::make_shared<state>(opts)}
         {
         }
 
@@ -71,20 +136,105 @@ namespace rpp::schedulers
     private:
         class state
         {
+            struct node_workers
+            {
+                size_t                       node{};
+                std::vector<original_worker> workers{};
+                size_t                       index{};
+
+                worker_strategy get() { return worker_strategy{workers[index++ % workers.size()]}; }
+            };
+
+            struct thread_placement
+            {
+                std::vector<size_t> cpus{};
+                size_t              node{};
+                std::string         name{};
+
+                void apply() const
+                {
+                    details::set_current_thread_affinity(cpus);
+                    details::set_current_thread_name(name);
+                }
+            };
+
         public:
-            explicit state(size_t threads_count)
+            explicit state(const options& opts)
             {
-                threads_count = std::max(size_t{1}, threads_count);
-                m_workers.reserve(threads_count);
+                const size_t threads_count = std::max(size_t{1}, opts.threads_count);
+
+                std::vector<thread_placement> placements(threads_count);
                 for (size_t i = 0; i < threads_count; ++i)
-                    m_workers.emplace_back(new_thread::create_worker());
+                    placements[i] = get_placement(opts, i);
+
+                if (opts.pool_mode == mode::work_stealing)
+                {
+                    m_pool = std::make_shared<details::work_stealing_pool>(threads_count, [placements](size_t index) { placements[index].apply(); }, opts.idle, opts.timer_slack);
+                    return;
+                }
+
+                for (const auto& placement : placements)
+                {
+                    auto worker = original_worker{new_thread::options{[placement] { placement.apply(); }, opts.idle, opts.timer_slack, opts.starvation_limit}, instrumentation::scheduler_kind::thread_pool};
+
+                    const auto it = std::find_if(m_nodes.begin(), m_nodes.end(), [&](const node_workers& n) { return n.node == placement.node; });
+                    (it == m_nodes.end() ? m_nodes.emplace_back(node_workers{placement.node}) : *it).workers.push_back(std::move(worker));
+                }
+            }
+
+            worker_strategy get()
+            {
+                if (m_pool)
+                    return worker_strategy{details::serial_queue::make(m_pool)};
+
+                if (m_nodes.size() == 1)
+                    return m_nodes.front().get();
+
+                const size_t current_node = details::get_current_numa_node();
+                for (auto& node : m_nodes)
+                {
+                    if (node.node == current_node)
+                        return node.get();
+                }
+                return m_nodes[m_index++ % m_nodes.size()].get();
+            }
+
+        private:
+            static thread_placement get_placement(const options& opts, size_t index)
+            {
+                thread_placement res{};
+                if (!opts.thread_name_prefix.empty())
+                    res.name = opts.thread_name_prefix + std::to_string(index);
+
+                const auto& nodes = details::get_numa_nodes();
+                if (!opts.affinity.empty())
+                {
+                    res.cpus = opts.affinity[index % opts.affinity.size()];
+                    if (!res.cpus.empty())
+                        res.node = get_node_of_cpu(nodes, res.cpus.front());
+                }
+                else if (opts.numa_aware)
+                {
+                    res.node = index % nodes.size();
+                    res.cpus = nodes[res.node];
+                }
+                return res;
             }
 
-            const original_worker& get() { return m_workers[m_index++ % m_workers.size()]; }
+            static size_t get_node_of_cpu(const std::vector<std::vector<size_t>>& nodes, size_t cpu)
+            {
+                for (size_t node = 0; node < nodes.size(); ++node)
+                {
+                    if (std::find(nodes[node].begin(), nodes[node].end(), cpu) != nodes[node].end())
+                        return node;
+                }
+                return 0;
+            }
 
         private:
-            std::vector<original_worker> m_workers{};
-            size_t                       m_index{};
+            std::shared_ptr<details::work_stealing_pool> m_pool{};
+            std::vector<node_workers>                    m_nodes{};
+            size_t                                       m_index{};
         };
 
         std::shared_ptr<state> m_state{};
@@ -133,7 +133,7 @@ namespace rpp::details
         template<constraint::observer_strategy<value_type> Strategy>
         void subscribe(observer<value_type, Strategy>&& obs) const
         {
-            drain(std::make_shared<concat_state_t<observer<value_type, Strategy>, PackedContainer>>(std::move(obs), container));
+            drain(rpp::details::make_shared_state<concat_state_t<observer<value_type, Strategy>, PackedContainer>>(std::move(obs), container));
         }
     };
 
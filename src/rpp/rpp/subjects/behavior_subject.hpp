@@ -46,7 +46,7 @@ namespace rpp::subjects::details
         {
             static constexpr auto preferred_disposables_mode = rpp::details::observers::disposables_mode::None;
 
-            std::shared_ptr<behavior_state> state;
+            rpp::disposable_ptr<behavior_state> state;
 
             void set_upstream(const disposable_wrapper& d) const noexcept { state->add(d); }
 
@@ -67,46 +67,45 @@ namespace rpp::subjects::details
         using optimal_disposables_strategy = typename details::subject_state<Type, Serialized>::optimal_disposables_strategy;
 
         explicit behavior_subject_base(const Type& value)
-            : m_state{disposable_wrapper_impl<behavior_state>::make(value)}
+            : m_state{rpp::details::lock_disposable(disposable_wrapper_impl<behavior_state>::make(value))}
         {
         }
 
         explicit behavior_subject_base(Type&& value)
-            : m_state{disposable_wrapper_impl<behavior_state>::make(std::move(value))}
+            : m_state{rpp::details::lock_disposable(disposable_wrapper_impl<behavior_state>::make(std::move(value)))}
         {
         }
 
         auto get_observer() const
         {
-            return rpp::observer<Type, observer_strategy>{m_state.lock()};
+            return rpp::observer<Type, observer_strategy>{m_state};
         }
 
         auto get_observable() const
         {
             return create_subject_on_subscribe_observable<Type, optimal_disposables_strategy>([state = m_state]<rpp::constraint::observer_of_type<Type> TObs>(TObs&& observer) {
-                const auto locked = state.lock();
-                if (!locked->is_disposed())
+                if (!state->is_disposed())
                 {
-                    auto v = *locked->get_value();
+                    auto v = *state->get_value();
                     observer.on_next(std::move(v));
                 }
-                locked->on_subscribe(std::forward<TObs>(observer));
+                state->on_subscribe(std::forward<TObs>(observer));
             });
         }
 
         rpp::disposable_wrapper get_disposable() const
         {
-            return m_state;
+            return m_state->wrapper_from_this();
         }
 
         Type get_value() const
         {
-            return *m_state.lock()->get_value();
+            return *m_state->get_value();
         }
 
 
     private:
-        disposable_wrapper_impl<behavior_state> m_state;
+        rpp::disposable_ptr<behavior_state> m_state;
     };
 } // namespace rpp::subjects::details
 
@@ -22,6 +22,7 @@
 #include <algorithm>
 #include <deque>
 #include <memory>
+#include <memory_resource>
 #include <mutex>
 #include <variant>
 
@@ -44,7 +45,7 @@ namespace rpp::subjects::details
             , public rpp::details::base_disposable
         {
         public:
-            disposable_with_observer(TObs&& observer, std::weak_ptr<subject_state> state)
+            disposable_with_observer(TObs&& observer, disposable_wrapper_impl<subject_state> state)
                 : rpp::details::observers::type_erased_observer<TObs>{std::move(observer)}
                 , m_state{std::move(state)}
             {
@@ -53,21 +54,21 @@ namespace rpp::subjects::details
         private:
             void base_dispose_impl(interface_disposable::Mode) noexcept override
             {
-                if (const auto shared = m_state.lock())
+                if (const auto shared = rpp::details::lock_disposable(m_state))
                 {
                     std::unique_lock lock{shared->m_mutex};
                     process_state_unsafe(shared->m_state,
                                          [&](const shared_observers& observers) {
-                                             shared->m_state = cleanup_observers(observers, this);
+                                             shared->m_state = shared->cleanup_observers(observers, this);
                                          });
                 }
             }
 
-            std::weak_ptr<subject_state> m_state{};
+            disposable_wrapper_impl<subject_state> m_state;
         };
 
-        using observer         = std::shared_ptr<rpp::details::observers::observer_vtable<Type>>;
-        using observers        = std::deque<observer>;
+        using observer         = rpp::disposable_ptr<rpp::details::observers::observer_vtable<Type>>;
+        using observers        = std::pmr::deque<observer>;
         using shared_observers = std::shared_ptr<observers>;
         using state_t          = std::variant<shared_observers, std::exception_ptr, completed, disposed>;
 
@@ -83,11 +84,11 @@ namespace rpp::subjects::details
             process_state_unsafe(
                 m_state,
                 [&](const shared_observers& observers) {
-                    auto d   = disposable_wrapper_impl<disposable_with_observer<std::decay_t<TObs>>>::make(std::forward<TObs>(observer), this->wrapper_from_this().lock());
-                    auto ptr = d.lock();
+                    auto d   = disposable_wrapper_impl<disposable_with_observer<std::decay_t<TObs>>>::make(std::forward<TObs>(observer), this->wrapper_from_this().as_weak());
+                    auto ptr = rpp::details::lock_disposable(d);
                     if (!observers)
                     {
-                        auto new_observers = std::make_shared<subject_state::observers>();
+                        auto new_observers = std::make_shared<subject_state::observers>(m_memory_resource);
                         new_observers->emplace_back(ptr);
                         m_state = std::move(new_observers);
                     }
@@ -156,9 +157,9 @@ namespace rpp::subjects::details
             exchange_observers_under_lock_if_there(disposed{});
         }
 
-        static shared_observers cleanup_observers(const shared_observers& current_subs, const rpp::details::observers::observer_vtable<Type>* to_delete)
+        shared_observers cleanup_observers(const shared_observers& current_subs, const rpp::details::observers::observer_vtable<Type>* to_delete) const
         {
-            auto subs = std::make_shared<observers>();
+            auto subs = std::make_shared<observers>(m_memory_resource);
             if (current_subs)
             {
                 std::copy_if(current_subs->cbegin(),
@@ -188,6 +189,7 @@ namespace rpp::subjects::details
 
     private:
         state_t                                                                                  m_state;
+        std::pmr::memory_resource*                                                               m_memory_resource = rpp::details::current_memory_resource();
         std::mutex                                                                               m_mutex{};
         RPP_NO_UNIQUE_ADDRESS std::conditional_t<Serialized, std::mutex, rpp::utils::none_mutex> m_serialized_mutex{};
     };
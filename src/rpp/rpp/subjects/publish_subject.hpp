@@ -25,7 +25,7 @@ namespace rpp::subjects::details
         {
             static constexpr auto preferred_disposables_mode = rpp::details::observers::disposables_mode::None;
 
-            std::shared_ptr<details::subject_state<Type, Serialized>> state{};
+            rpp::disposable_ptr<details::subject_state<Type, Serialized>> state{};
 
             void set_upstream(const disposable_wrapper& d) const noexcept { state->add(d); }
 
@@ -45,21 +45,22 @@ namespace rpp::subjects::details
 
         auto get_observer() const
         {
-            return rpp::observer<Type, observer_strategy>{m_state.lock()};
+            return rpp::observer<Type, observer_strategy>{m_state};
         }
 
         auto get_observable() const
         {
-            return create_subject_on_subscribe_observable<Type, optimal_disposables_strategy>([state = m_state]<rpp::constraint::observer_of_type<Type> TObs>(TObs&& observer) { state.lock()->on_subscribe(std::forward<TObs>(observer)); });
+            return create_subject_on_subscribe_observable<Type, optimal_disposables_strategy>([state = m_state]<rpp::constraint::observer_of_type<Type> TObs>(TObs&& observer) { state->on_subscribe(std::forward<TObs>(observer)); });
         }
 
         rpp::disposable_wrapper get_disposable() const
         {
-            return m_state;
+            return m_state->wrapper_from_this();
         }
 
     private:
-        disposable_wrapper_impl<details::subject_state<Type, Serialized>> m_state = disposable_wrapper_impl<subject_state<Type, Serialized>>::make();
+        // state always exists, so it is kept locked to avoid extra checks on each access
+        rpp::disposable_ptr<details::subject_state<Type, Serialized>> m_state = rpp::details::lock_disposable(disposable_wrapper_impl<subject_state<Type, Serialized>>::make());
     };
 } // namespace rpp::subjects::details
 namespace rpp::subjects
@@ -18,6 +18,7 @@
 #include <rpp/subjects/details/subject_state.hpp>
 
 #include <deque>
+#include <memory_resource>
 #include <utility>
 
 namespace rpp::subjects::details
@@ -55,11 +56,11 @@ namespace rpp::subjects::details
             };
 
 
-            std::deque<value_with_time> get_actual_values()
+            std::pmr::deque<value_with_time> get_actual_values()
             {
                 std::unique_lock lock{m_values_mutex};
                 deduce_timepoint();
-                return m_values;
+                return std::pmr::deque<value_with_time>{m_values, m_values.get_allocator()};
             }
 
         private:
@@ -75,8 +76,8 @@ namespace rpp::subjects::details
             }
 
         private:
-            std::mutex                  m_values_mutex{};
-            std::deque<value_with_time> m_values{};
+            std::mutex                       m_values_mutex{};
+            std::pmr::deque<value_with_time> m_values{rpp::details::current_memory_resource()};
 
             const size_t                    m_limit;
             const rpp::schedulers::duration m_duration_limit;
@@ -86,7 +87,7 @@ namespace rpp::subjects::details
         {
             static constexpr auto preferred_disposables_mode = rpp::details::observers::disposables_mode::None;
 
-            std::shared_ptr<replay_state> state;
+            rpp::disposable_ptr<replay_state> state;
 
             void set_upstream(const disposable_wrapper& d) const noexcept { state->add(d); }
 
@@ -107,42 +108,41 @@ namespace rpp::subjects::details
         using optimal_disposables_strategy = typename details::subject_state<Type, Serialized>::optimal_disposables_strategy;
 
         replay_subject_base()
-            : m_state{disposable_wrapper_impl<replay_state>::make()}
+            : m_state{rpp::details::lock_disposable(disposable_wrapper_impl<replay_state>::make())}
         {
         }
 
         replay_subject_base(size_t count)
-            : m_state{disposable_wrapper_impl<replay_state>::make(std::max<size_t>(1, count))}
+            : m_state{rpp::details::lock_disposable(disposable_wrapper_impl<replay_state>::make(std::max<size_t>(1, count)))}
         {
         }
 
         replay_subject_base(size_t count, rpp::schedulers::duration duration)
-            : m_state{disposable_wrapper_impl<replay_state>::make(std::max<size_t>(1, count), duration)}
+            : m_state{rpp::details::lock_disposable(disposable_wrapper_impl<replay_state>::make(std::max<size_t>(1, count), duration))}
         {
         }
 
         auto get_observer() const
         {
-            return rpp::observer<Type, observer_strategy>{m_state.lock()};
+            return rpp::observer<Type, observer_strategy>{m_state};
         }
 
         auto get_observable() const
         {
             return create_subject_on_subscribe_observable<Type, optimal_disposables_strategy>([state = m_state]<rpp::constraint::observer_of_type<Type> TObs>(TObs&& observer) {
-                const auto locked = state.lock();
-                for (auto&& value : locked->get_actual_values())
+                for (auto&& value : state->get_actual_values())
                     observer.on_next(std::move(value.value));
-                locked->on_subscribe(std::forward<TObs>(observer));
+                state->on_subscribe(std::forward<TObs>(observer));
             });
         }
 
         rpp::disposable_wrapper get_disposable() const
         {
-            return m_state;
+            return m_state->wrapper_from_this();
         }
 
     private:
-        disposable_wrapper_impl<replay_state> m_state;
+        rpp::disposable_ptr<replay_state> m_state;
     };
 } // namespace rpp::subjects::details
 
@@ -29,6 +29,11 @@ namespace rpp::utils
         using std::runtime_error::runtime_error;
     };
 
+    struct deadline_missed : public std::runtime_error
+    {
+        using std::runtime_error::runtime_error;
+    };
+
     struct out_of_range : public std::range_error
     {
         using std::range_error::range_error;
@@ -0,0 +1,95 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <utility>
+
+namespace rpp::utils
+{
+    /**
+     * @brief Smart pointer to object with embedded reference counter.
+     * @details Object is expected to provide `add_ref()` and `release()` methods, where `release()` destroys object when last reference is released. Raw pointer passed to constructor is adopted as is (without `add_ref()`), so object is expected to be created with counter equal to 1.
+     */
+    template<typename T>
+    class intrusive_ptr
+    {
+        template<typename U>
+        friend class intrusive_ptr;
+
+    public:
+        intrusive_ptr() = default;
+
+        intrusive_ptr(std::nullptr_t) noexcept {}
+
+        explicit intrusive_ptr(T* ptr) noexcept
+            : m_ptr{ptr}
+        {
+        }
+
+        intrusive_ptr(const intrusive_ptr& other) noexcept
+            : m_ptr{other.m_ptr}
+        {
+            if (m_ptr)
+                m_ptr->add_ref();
+        }
+
+        intrusive_ptr(intrusive_ptr&& other) noexcept
+            : m_ptr{std::exchange(other.m_ptr, nullptr)}
+        {
+        }
+
+        template<typename U>
+            requires std::convertible_to<U*, T*>
+        intrusive_ptr(intrusive_ptr<U>&& other) noexcept
+            : m_ptr{std::exchange(other.m_ptr, nullptr)}
+        {
+        }
+
+        ~intrusive_ptr() noexcept
+        {
+            if (m_ptr)
+                m_ptr->release();
+        }
+
+        intrusive_ptr& operator=(const intrusive_ptr& other) noexcept
+        {
+            intrusive_ptr{other}.swap(*this);
+            return *this;
+        }
+
+        intrusive_ptr& operator=(intrusive_ptr&& other) noexcept
+        {
+            intrusive_ptr{std::move(other)}.swap(*this);
+            return *this;
+        }
+
+        void swap(intrusive_ptr& other) noexcept { std::swap(m_ptr, other.m_ptr); }
+
+        /**
+         * @brief Releases ownership of the object without decrementing of reference counter.
+         */
+        T* detach() noexcept { return std::exchange(m_ptr, nullptr); }
+
+        T* get() const noexcept { return m_ptr; }
+        T* operator->() const noexcept { return m_ptr; }
+        T& operator*() const noexcept { return *m_ptr; }
+
+        explicit operator bool() const noexcept { return m_ptr != nullptr; }
+
+        bool operator==(const intrusive_ptr& other) const noexcept = default;
+        bool operator==(std::nullptr_t) const noexcept { return m_ptr == nullptr; }
+
+    private:
+        T* m_ptr{};
+    };
+} // namespace rpp::utils
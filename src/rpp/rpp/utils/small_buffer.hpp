@@ -0,0 +1,80 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace rpp::utils
+{
+    /**
+     * @brief Raw storage to place type-erased object inline instead of separate heap allocation.
+     * @details Buffer doesn't track type of stored object: owner is responsible to construct, relocate and destroy it with correct type (usually via own table of function pointers).
+     *
+     * @tparam Size maximum size of object in bytes
+     */
+    template<size_t Size>
+    class small_buffer
+    {
+    public:
+        /**
+         * @brief Object can be placed inside buffer: it fits by size and alignment and can be relocated without exceptions.
+         */
+        template<typename T>
+        static constexpr bool fits = sizeof(T) <= Size && alignof(T) <= alignof(void*) && std::is_nothrow_move_constructible_v<T>;
+
+        small_buffer() = default;
+
+        small_buffer(const small_buffer&)            = delete;
+        small_buffer& operator=(const small_buffer&) = delete;
+
+        template<typename T, typename... Args>
+            requires fits<T>
+        T& emplace(Args&&... args)
+        {
+            return *std::construct_at(reinterpret_cast<T*>(m_data), std::forward<Args>(args)...);
+        }
+
+        template<typename T>
+        T& get() noexcept
+        {
+            return *std::launder(reinterpret_cast<T*>(m_data));
+        }
+
+        template<typename T>
+        const T& get() const noexcept
+        {
+            return *std::launder(reinterpret_cast<const T*>(m_data));
+        }
+
+        template<typename T>
+        void destroy() noexcept
+        {
+            std::destroy_at(&get<T>());
+        }
+
+        /**
+         * @brief Moves object of type `T` into `other` buffer and destroys original one.
+         */
+        template<typename T>
+        void relocate_to(small_buffer& other) noexcept
+        {
+            other.emplace<T>(std::move(get<T>()));
+            destroy<T>();
+        }
+
+    private:
+        alignas(void*) std::byte m_data[Size];
+    };
+} // namespace rpp::utils
@@ -164,5 +164,5 @@ TEST_CASE("combine_latest satisfies disposable contracts")
         test_operator_finish_before_dispose<int>(op);
     }
 
-    CHECK((observable_disposable.is_disposed() || observable_disposable.lock().use_count() == 2));
+    CHECK((observable_disposable.is_disposed() || rpp::details::lock_disposable(observable_disposable).use_count() == 2));
 }
@@ -282,6 +282,138 @@ TEST_CASE("composite_disposable correctly handles exception")
     CHECK(!d2.is_disposed());
 }
 
+TEST_CASE("disposable_wrapper shares intrusive strong/weak counters")
+{
+    auto d    = rpp::composite_disposable_wrapper::make();
+    auto weak = d.as_weak();
+
+    CHECK(!weak.is_disposed());
+    CHECK(weak == d);
+
+    SUBCASE("lock increments strong counter")
+    {
+        const auto locked = rpp::details::lock_disposable(weak);
+        REQUIRE(locked);
+        CHECK(locked.use_count() == 2);
+        CHECK(rpp::details::lock_disposable(d).use_count() == 3);
+    }
+
+    SUBCASE("weak wrapper observes dispose of strong one")
+    {
+        d.dispose();
+        CHECK(weak.is_disposed());
+        CHECK(weak.lock());
+    }
+
+    SUBCASE("weak wrapper observes dispose via weak one")
+    {
+        weak.dispose();
+        CHECK(d.is_disposed());
+    }
+
+    SUBCASE("weak wrapper is disposed and expired after destruction of last strong one")
+    {
+        d = rpp::composite_disposable_wrapper::empty();
+        CHECK(weak.is_disposed());
+        CHECK(!weak.lock());
+        CHECK(weak == rpp::composite_disposable_wrapper::empty());
+        weak.dispose();
+    }
+
+    SUBCASE("shared_ptr obtained from lock keeps disposable alive")
+    {
+        static_assert(std::same_as<decltype(d.lock()), std::shared_ptr<rpp::interface_composite_disposable>>);
+
+        auto shared = d.lock();
+        d           = rpp::composite_disposable_wrapper::empty();
+        CHECK(!weak.is_disposed());
+        CHECK(!shared->is_disposed());
+
+        shared.reset();
+        CHECK(weak.is_disposed());
+    }
+
+    SUBCASE("weak wrapper over disposable without disposed flag")
+    {
+        auto custom      = rpp::disposable_wrapper_impl<custom_disposable>::make();
+        auto custom_weak = custom.as_weak();
+
+        custom.dispose();
+        custom.dispose();
+        CHECK(custom_weak.is_disposed());
+    }
+
+    SUBCASE("wrapper_from_this shares counters")
+    {
+        auto refcount  = rpp::disposable_wrapper_impl<rpp::refcount_disposable>::make();
+        auto from_this = refcount.lock()->wrapper_from_this();
+        CHECK(from_this == refcount);
+        CHECK(rpp::details::lock_disposable(refcount).use_count() == 3);
+    }
+}
+
+TEST_CASE("dynamic_disposables_container removes by handle")
+{
+    rpp::details::disposables::dynamic_disposables_container container{};
+
+    auto d1 = rpp::composite_disposable_wrapper::make();
+    auto d2 = rpp::composite_disposable_wrapper::make();
+
+    const auto h1 = container.push_back(d1);
+    const auto h2 = container.push_back(d2);
+    CHECK(h1 != h2);
+
+    SUBCASE("remove by handle")
+    {
+        container.remove(h1);
+        container.dispose();
+        CHECK(!d1.is_disposed());
+        CHECK(d2.is_disposed());
+    }
+
+    SUBCASE("stale handle doesn't remove disposable placed into same slot")
+    {
+        auto d3 = rpp::composite_disposable_wrapper::make();
+
+        container.remove(h1);
+        const auto h3 = container.push_back(d3);
+        CHECK(h3.index == h1.index);
+        CHECK(h3 != h1);
+
+        container.remove(h1);
+        container.dispose();
+        CHECK(!d1.is_disposed());
+        CHECK(d2.is_disposed());
+        CHECK(d3.is_disposed());
+    }
+
+    SUBCASE("handle is invalidated by clear")
+    {
+        container.clear();
+        const auto h3 = container.push_back(d1);
+        container.remove(h1);
+        container.remove(h2);
+        container.dispose();
+        CHECK(h3 != h1);
+        CHECK(d1.is_disposed());
+        CHECK(!d2.is_disposed());
+    }
+
+    SUBCASE("composite_disposable removes by handle")
+    {
+        auto composite = rpp::disposable_wrapper_impl<rpp::composite_disposable>::make();
+        auto d3        = rpp::composite_disposable_wrapper::make();
+
+        const auto handle = composite.lock()->add_with_handle(d3);
+        composite.lock()->remove(handle);
+        composite.dispose();
+        CHECK(!d3.is_disposed());
+
+        CHECK(composite.lock()->add_with_handle(d3) == rpp::details::disposables::disposable_handle{});
+        CHECK(d3.is_disposed());
+    }
+}
+
 TEST_CASE("static_disposables_container works as expected")
 {
     rpp::details::disposables::static_disposables_container<2> container{};
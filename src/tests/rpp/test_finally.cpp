@@ -111,5 +111,5 @@ TEST_CASE("finally satisfies disposable contracts")
             rpp::ops::finally([]() noexcept {}));
     }
 
-    CHECK((observable_disposable.is_disposed() || observable_disposable.lock().use_count() == 2));
+    CHECK((observable_disposable.is_disposed() || rpp::details::lock_disposable(observable_disposable).use_count() == 2));
 }
@@ -0,0 +1,238 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#include <doctest/doctest.h>
+
+#include <rpp/disposables/composite_disposable.hpp>
+#include <rpp/memory_model.hpp>
+#include <rpp/observers/mock_observer.hpp>
+#include <rpp/operators/delay.hpp>
+#include <rpp/operators/distinct.hpp>
+#include <rpp/operators/group_by.hpp>
+#include <rpp/operators/merge.hpp>
+#include <rpp/operators/subscribe.hpp>
+#include <rpp/operators/take_until.hpp>
+#include <rpp/operators/zip.hpp>
+#include <rpp/schedulers/test_scheduler.hpp>
+#include <rpp/subjects/publish_subject.hpp>
+#include <rpp/subjects/replay_subject.hpp>
+
+#include <array>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <thread>
+
+namespace
+{
+    class counting_resource final : public std::pmr::memory_resource
+    {
+    public:
+        size_t allocations{};
+
+    private:
+        void* do_allocate(size_t bytes, size_t alignment) override
+        {
+            ++allocations;
+            return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void* p, size_t bytes, size_t alignment) override
+        {
+            std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+        }
+
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+    };
+} // namespace
+
+TEST_CASE("use_arena allocates states of subscription from single arena")
+{
+    auto mock = mock_observer_strategy<int>();
+
+    rpp::subjects::publish_subject<int> source{};
+    rpp::subjects::publish_subject<int> other{};
+    rpp::subjects::publish_subject<int> until{};
+
+    rpp::disposable_wrapper d{};
+    size_t                  used_size{};
+    {
+        rpp::memory_model::use_arena arena{};
+        d = source.get_observable() | rpp::ops::merge_with(other.get_observable()) | rpp::ops::take_until(until.get_observable()) | rpp::ops::subscribe_with_disposable(mock.get_observer());
+
+        used_size = arena.get_used_size();
+        CHECK(used_size > 0);
+    }
+
+    SUBCASE("subscription works after end of scope")
+    {
+        source.get_observer().on_next(1);
+        other.get_observer().on_next(2);
+        CHECK(mock.get_received_values() == std::vector{1, 2});
+
+        until.get_observer().on_next(0);
+        CHECK(mock.get_on_completed_count() == 1);
+        CHECK(d.is_disposed());
+    }
+
+    SUBCASE("subscription can be disposed after end of scope")
+    {
+        d.dispose();
+        source.get_observer().on_next(1);
+        CHECK(mock.get_received_values().empty());
+    }
+}
+
+TEST_CASE("use_arena scopes")
+{
+    SUBCASE("states are allocated from the heap without scope")
+    {
+        CHECK(rpp::details::s_current_arena == nullptr);
+    }
+
+    SUBCASE("nested scope takes precedence and restores previous one")
+    {
+        rpp::memory_model::use_arena outer{};
+        {
+            rpp::memory_model::use_arena inner{};
+            const auto                   state = rpp::details::make_shared_state<int>(1);
+            CHECK(inner.get_used_size() > 0);
+            CHECK(outer.get_used_size() == 0);
+        }
+        CHECK(rpp::details::s_current_arena != nullptr);
+
+        const auto state = rpp::details::make_shared_state<int>(2);
+        CHECK(outer.get_used_size() > 0);
+    }
+    CHECK(rpp::details::s_current_arena == nullptr);
+
+    SUBCASE("state outlives scope")
+    {
+        std::shared_ptr<int> state{};
+        {
+            rpp::memory_model::use_arena arena{};
+            state = rpp::details::make_shared_state<int>(3);
+        }
+        CHECK(*state == 3);
+    }
+
+    SUBCASE("state can be destroyed from other thread")
+    {
+        std::shared_ptr<int> state{};
+        {
+            rpp::memory_model::use_arena arena{};
+            state = rpp::details::make_shared_state<int>(4);
+            std::thread{[s = std::move(state)] { CHECK(*s == 4); }}.join();
+        }
+        CHECK(state == nullptr);
+    }
+
+    SUBCASE("allocations beyond max_size go to the heap")
+    {
+        rpp::memory_model::use_arena arena{rpp::memory_model::use_arena::options{.chunk_size = 128, .max_size = 128}};
+
+        const auto small = rpp::details::make_shared_state<int>(1);
+        const auto used  = arena.get_used_size();
+        CHECK(used > 0);
+
+        const auto big = rpp::details::make_shared_state<std::array<char, 1024>>();
+        CHECK(arena.get_used_size() == used);
+        big->fill('a');
+        CHECK(big->back() == 'a');
+        CHECK(*small == 1);
+    }
+}
+
+TEST_CASE("use_memory_resource provides resource for internal containers")
+{
+    counting_resource resource{};
+    auto              mock = mock_observer_strategy<int>();
+
+    rpp::subjects::publish_subject<int> source{};
+
+    SUBCASE("operators capture resource during subscription")
+    {
+        rpp::subjects::publish_subject<int> other{};
+        {
+            rpp::memory_model::use_memory_resource scope{&resource};
+            source.get_observable() | rpp::ops::zip([](int l, int r) { return l + r; }, other.get_observable()) | rpp::ops::distinct() | rpp::ops::subscribe(mock);
+        }
+        const auto allocations = resource.allocations;
+
+        source.get_observer().on_next(1);
+        source.get_observer().on_next(2);
+        other.get_observer().on_next(10);
+        other.get_observer().on_next(11);
+
+        CHECK(mock.get_received_values() == std::vector{11, 13});
+        CHECK(resource.allocations > allocations);
+    }
+
+    SUBCASE("delay keeps its queue in resource")
+    {
+        rpp::schedulers::test_scheduler scheduler{};
+        {
+            rpp::memory_model::use_memory_resource scope{&resource};
+            source.get_observable() | rpp::ops::delay(std::chrono::seconds{1}, scheduler) | rpp::ops::subscribe(mock);
+        }
+        const auto allocations = resource.allocations;
+
+        for (int i = 0; i < 1000; ++i)
+            source.get_observer().on_next(i);
+        CHECK(resource.allocations > allocations);
+
+        scheduler.time_advance(std::chrono::seconds{1});
+        CHECK(mock.get_received_values().size() == 1000);
+    }
+
+    SUBCASE("group_by keeps its groups in resource")
+    {
+        {
+            rpp::memory_model::use_memory_resource scope{&resource};
+            source.get_observable() | rpp::ops::group_by([](int v) { return v % 2; }) | rpp::ops::subscribe([&](const auto& group) { group.subscribe(mock); });
+        }
+        const auto allocations = resource.allocations;
+
+        source.get_observer().on_next(1);
+        source.get_observer().on_next(2);
+        CHECK(mock.get_received_values() == std::vector{1, 2});
+        CHECK(resource.allocations > allocations);
+    }
+
+    SUBCASE("subjects capture resource during construction")
+    {
+        std::optional<rpp::subjects::replay_subject<int>> subject{};
+        {
+            rpp::memory_model::use_memory_resource scope{&resource};
+            subject.emplace();
+        }
+        CHECK(rpp::details::current_memory_resource() == std::pmr::get_default_resource());
+
+        subject->get_observable().subscribe(mock);
+        const auto allocations = resource.allocations;
+        CHECK(allocations > 0);
+
+        for (int i = 0; i < 1000; ++i)
+            subject->get_observer().on_next(i);
+        CHECK(resource.allocations > allocations);
+
+        auto replayed = mock_observer_strategy<int>();
+        subject->get_observable().subscribe(replayed);
+        CHECK(replayed.get_received_values().size() == 1000);
+    }
+
+    SUBCASE("without scope default resource is used")
+    {
+        CHECK(rpp::details::current_memory_resource() == std::pmr::get_default_resource());
+        source.get_observable() | rpp::ops::distinct() | rpp::ops::subscribe(mock);
+        source.get_observer().on_next(1);
+        CHECK(resource.allocations == 0);
+    }
+}
@@ -23,8 +23,10 @@
 #include "rpp/operators/subscribe.hpp"
 #include "rpp/operators/take.hpp"
 
+#include <array>
 #include <chrono>
 #include <thread>
+#include <vector>
 
 TEST_CASE("create observable works properly as observable")
 {
@@ -103,6 +105,56 @@ TEST_CASE("create observable works properly as observable")
     {
         test(std::move(observable).as_dynamic()); // NOLINT
     }
+
+    SUBCASE("copy of dynamic observable")
+    {
+        const auto dynamic = observable.as_dynamic();
+        auto       copy    = dynamic;
+        test(std::move(copy));
+    }
+}
+
+TEST_CASE("dynamic observable exceeding inline storage")
+{
+    size_t on_subscribe_called{};
+    auto   observable = rpp::source::create<int>([&on_subscribe_called, data = std::array<char, 256>{}](const auto& sub) {
+        ++on_subscribe_called;
+        sub.on_next(data[0]);
+        sub.on_completed();
+    });
+
+    auto dynamic = observable.as_dynamic();
+    auto copy    = dynamic;
+    auto moved   = std::move(dynamic);
+
+    auto mock = mock_observer_strategy<int>{};
+    copy.subscribe(mock);
+    moved.subscribe(mock);
+
+    CHECK(on_subscribe_called == 2u);
+    CHECK(mock.get_received_values() == std::vector{0, 0});
+    CHECK(mock.get_on_completed_count() == 2);
+}
+
+TEST_CASE("dynamic observable passes observer which can be copied by original observable")
+{
+    std::vector<rpp::dynamic_observer<int>> observers{};
+    auto                                    observable = rpp::source::create<int>([&observers](const rpp::dynamic_observer<int>& sub) {
+        observers.push_back(sub);
+        observers.push_back(sub);
+    });
+
+    auto mock = mock_observer_strategy<int>{};
+    observable.as_dynamic().subscribe(mock);
+
+    REQUIRE(observers.size() == 2u);
+    observers[0].on_next(1);
+    observers[1].on_next(2);
+    observers[1].on_completed();
+
+    CHECK(observers[0].is_disposed());
+    CHECK(mock.get_received_values() == std::vector{1, 2});
+    CHECK(mock.get_on_completed_count() == 1);
 }
 
 TEST_CASE("blocking_observable blocks subscribe call")
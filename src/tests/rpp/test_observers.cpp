@@ -10,10 +10,12 @@
 #include <doctest/doctest.h>
 
 #include <rpp/observers.hpp>
+#include <rpp/observers/mock_observer.hpp>
 
 #include "rpp/disposables/fwd.hpp"
 #include "rpp_trompeloil.hpp"
 
+#include <array>
 #include <memory>
 #include <vector>
 
@@ -316,3 +318,74 @@ TEST_CASE("on_error if exception during on_next")
         rpp::observer<int, mock_observer<int>>{observer}.on_next(v);
     }
 }
+
+TEST_CASE("unique dynamic observer keeps original observer")
+{
+    using unique_observer = rpp::observer<int, rpp::details::observers::unique_dynamic_strategy<int>>;
+    static_assert(!std::is_copy_constructible_v<unique_observer>, "unique dynamic observer shouldn't be copy constructible");
+
+    auto check = [&](auto&& mock, auto&& observer) {
+        auto unique = unique_observer{std::forward<decltype(observer)>(observer)};
+
+        SUBCASE("obtains callbacks")
+        {
+            unique.on_next(1);
+            int v{2};
+            unique.on_next(v);
+            unique.on_completed();
+
+            CHECK(mock.get_received_values() == std::vector{1, 2});
+            CHECK(mock.get_on_completed_count() == 1);
+        }
+
+        SUBCASE("obtains callbacks after move")
+        {
+            auto moved = std::move(unique);
+            moved.on_next(1);
+            moved.on_error({});
+
+            CHECK(mock.get_received_values() == std::vector{1});
+            CHECK(mock.get_on_error_count() == 1);
+        }
+
+        SUBCASE("copies of converted dynamic observer share same observer")
+        {
+            auto dynamic = std::move(unique).as_dynamic();
+            auto copy    = dynamic; // NOLINT
+            dynamic.on_next(1);
+            copy.on_next(2);
+            dynamic.on_completed();
+
+            CHECK(copy.is_disposed());
+            CHECK(mock.get_received_values() == std::vector{1, 2});
+            CHECK(mock.get_on_completed_count() == 1);
+        }
+
+        SUBCASE("set_upstream is forwarded")
+        {
+            auto d = rpp::composite_disposable_wrapper::make();
+            unique.set_upstream(rpp::disposable_wrapper{d});
+            unique.on_completed();
+
+            CHECK(d.is_disposed());
+        }
+    };
+
+    SUBCASE("small observer")
+    {
+        auto mock = mock_observer_strategy<int>{};
+        check(mock, mock.get_observer());
+    }
+
+    SUBCASE("big observer")
+    {
+        auto mock = mock_observer_strategy<int>{};
+        check(mock, rpp::make_lambda_observer<int>([mock, data = std::array<char, 256>{}](int v) { mock.on_next(v + data[0]); }, [mock](const std::exception_ptr& err) { mock.on_error(err); }, [mock]() { mock.on_completed(); }));
+    }
+
+    SUBCASE("dynamic observer")
+    {
+        auto mock = mock_observer_strategy<int>{};
+        check(mock, mock.get_observer().as_dynamic());
+    }
+}
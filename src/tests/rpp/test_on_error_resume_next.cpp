@@ -174,5 +174,5 @@ TEST_CASE("on_error_resume_next satisfies disposable contracts")
         test_operator_finish_before_dispose<int>(op);
     }
 
-    CHECK((observable_disposable.is_disposed() || observable_disposable.lock().use_count() == 2));
+    CHECK((observable_disposable.is_disposed() || rpp::details::lock_disposable(observable_disposable).use_count() == 2));
 }
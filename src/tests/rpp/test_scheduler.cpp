@@ -15,22 +15,38 @@
 #include <rpp/observers/lambda_observer.hpp>
 #include <rpp/observers/mock_observer.hpp>
 #include <rpp/operators/as_blocking.hpp>
+#include <rpp/operators/debounce.hpp>
 #include <rpp/operators/subscribe_on.hpp>
+#include <rpp/operators/take.hpp>
 #include <rpp/schedulers.hpp>
+#include <rpp/schedulers/epoll_loop.hpp>
+#include <rpp/schedulers/simulation_scheduler.hpp>
 #include <rpp/schedulers/test_scheduler.hpp>
+#include <rpp/sources/interval.hpp>
 #include <rpp/sources/just.hpp>
 
 #include "rpp/disposables/fwd.hpp"
 #include "rpp_trompeloil.hpp"
 
+#include <algorithm>
 #include <chrono>
+#include <cmath>
+#include <condition_variable>
 #include <future>
+#include <mutex>
+#include <numeric>
 #include <optional>
+#include <set>
 #include <sstream>
 #include <stdexcept>
 #include <string>
 #include <thread>
 
+#if defined(__linux__)
+    #include <sys/socket.h>
+    #include <unistd.h>
+#endif
+
 using namespace std::string_literals;
 
 static std::string get_thread_id_as_string(std::thread::id id = std::this_thread::get_id())
@@ -347,7 +363,20 @@ TEST_CASE("Immediate scheduler")
     }
 }
 
-TEST_CASE_TEMPLATE("queue_based scheduler", TestType, rpp::schedulers::current_thread, rpp::schedulers::new_thread, rpp::schedulers::thread_pool)
+namespace
+{
+    struct new_thread_with_heap_backend
+    {
+        static auto create_worker() { return rpp::schedulers::new_thread::create_worker(rpp::schedulers::new_thread::options{.backend = rpp::schedulers::queue_backend::heap}); }
+    };
+
+    struct new_thread_with_batches
+    {
+        static auto create_worker() { return rpp::schedulers::new_thread::create_worker(rpp::schedulers::new_thread::options{.max_batch_size = 64}); }
+    };
+} // namespace
+
+TEST_CASE_TEMPLATE("queue_based scheduler", TestType, rpp::schedulers::current_thread, rpp::schedulers::new_thread, new_thread_with_heap_backend, new_thread_with_batches, rpp::schedulers::thread_pool)
 {
     auto d        = rpp::composite_disposable_wrapper::make();
     auto mock_obs = mock_observer_strategy<int>{};
@@ -766,6 +795,168 @@ TEST_CASE("new_thread works till end")
     CHECK(!before);
 }
 
+TEST_CASE("schedulables_queue keeps time_point and FIFO order")
+{
+    auto obs = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    auto test = [&](rpp::schedulers::queue_backend backend) {
+        rpp::schedulers::details::schedulables_queue<rpp::schedulers::current_thread::worker_strategy> queue{backend};
+
+        const auto                                               now = rpp::schedulers::clock_type::now();
+        std::vector<std::pair<rpp::schedulers::time_point, int>> expected{};
+        std::vector<int>                                         executions{};
+        for (int i = 0; i < 1000; ++i)
+        {
+            const auto tp = now + std::chrono::milliseconds{(i * 7919) % 100};
+            expected.emplace_back(tp, i);
+            queue.emplace(
+                tp,
+                [&executions](const auto&, int id) {
+                    executions.push_back(id);
+                    return rpp::schedulers::optional_delay_from_now{};
+                },
+                obs,
+                int{i});
+        }
+
+        std::stable_sort(expected.begin(), expected.end(), [](const auto& l, const auto& r) { return l.first < r.first; });
+
+        while (!queue.is_empty())
+            (*queue.pop())();
+
+        REQUIRE(executions.size() == expected.size());
+        for (size_t i = 0; i < expected.size(); ++i)
+            CHECK(executions[i] == expected[i].second);
+    };
+
+    SUBCASE("linked_list")
+    {
+        test(rpp::schedulers::queue_backend::linked_list);
+    }
+
+    SUBCASE("heap")
+    {
+        test(rpp::schedulers::queue_backend::heap);
+    }
+}
+
+TEST_CASE("schedulables_queue keeps order for mix of due and future schedulables")
+{
+    auto obs = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    auto test = [&](rpp::schedulers::queue_backend backend) {
+        rpp::schedulers::details::schedulables_queue<rpp::schedulers::current_thread::worker_strategy> queue{backend};
+
+        const auto                                               now = rpp::schedulers::details::now();
+        std::vector<std::pair<rpp::schedulers::time_point, int>> expected{};
+        std::vector<int>                                         executions{};
+        for (int i = 0; i < 1000; ++i)
+        {
+            // time_points from the past are due, the rest are not
+            const auto tp = now + std::chrono::milliseconds{(i * 7919) % 20 - 15};
+            expected.emplace_back(tp, i);
+            queue.emplace(
+                tp,
+                [&executions](const auto&, int id) {
+                    executions.push_back(id);
+                    return rpp::schedulers::optional_delay_from_now{};
+                },
+                obs,
+                int{i});
+        }
+
+        std::stable_sort(expected.begin(), expected.end(), [](const auto& l, const auto& r) { return l.first < r.first; });
+
+        while (!queue.is_empty())
+        {
+            if (queue.is_top_ready())
+                CHECK(queue.top()->get_timepoint() <= now);
+            (*queue.pop())();
+        }
+
+        REQUIRE(executions.size() == expected.size());
+        for (size_t i = 0; i < expected.size(); ++i)
+            CHECK(executions[i] == expected[i].second);
+    };
+
+    SUBCASE("linked_list")
+    {
+        test(rpp::schedulers::queue_backend::linked_list);
+    }
+
+    SUBCASE("heap")
+    {
+        test(rpp::schedulers::queue_backend::heap);
+    }
+
+    SUBCASE("future schedulables are not ready for queue with own clock")
+    {
+        rpp::schedulers::details::now();
+        rpp::schedulers::details::schedulables_queue<rpp::schedulers::test_scheduler::worker_strategy> queue{};
+        queue.emplace(rpp::schedulers::test_scheduler::now() + std::chrono::seconds{1}, [](const auto&) { return rpp::schedulers::optional_delay_from_now{}; }, obs);
+
+        CHECK(!queue.is_top_ready());
+    }
+
+    SUBCASE("zero-delay schedulables are ready")
+    {
+        rpp::schedulers::details::schedulables_queue<rpp::schedulers::current_thread::worker_strategy> queue{};
+        for (int i = 0; i < 3; ++i)
+            queue.emplace(rpp::schedulers::details::now(), [](const auto&) { return rpp::schedulers::optional_delay_from_now{}; }, obs);
+
+        queue.emplace(rpp::schedulers::details::now() + std::chrono::hours{1}, [](const auto&) { return rpp::schedulers::optional_delay_from_now{}; }, obs);
+
+        for (int i = 0; i < 3; ++i)
+        {
+            CHECK(queue.is_top_ready());
+            queue.pop();
+        }
+        CHECK(!queue.is_top_ready());
+        queue.pop();
+        CHECK(queue.is_empty());
+    }
+}
+
+TEST_CASE("run_loop scheduler with heap backend respects time_point")
+{
+    auto scheduler = rpp::schedulers::run_loop{rpp::schedulers::queue_backend::heap};
+    auto worker    = scheduler.create_worker();
+    auto obs       = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    std::vector<int> executions{};
+    worker.schedule(std::chrono::milliseconds{3}, [&](const auto&) {executions.push_back(3); return rpp::schedulers::optional_delay_from_now{}; }, obs);
+    worker.schedule(std::chrono::milliseconds{1}, [&](const auto&) {executions.push_back(1); return rpp::schedulers::optional_delay_from_now{}; }, obs);
+    worker.schedule(std::chrono::milliseconds{1}, [&](const auto&) {executions.push_back(2); return rpp::schedulers::optional_delay_from_now{}; }, obs);
+
+    while (!scheduler.is_empty())
+        scheduler.dispatch();
+
+    CHECK(executions == std::vector{1, 2, 3});
+}
+
+TEST_CASE("run_loop scheduler with batch size dispatches several tasks at once")
+{
+    auto scheduler = rpp::schedulers::run_loop{rpp::schedulers::queue_backend::linked_list, 2};
+    auto worker    = scheduler.create_worker();
+    auto obs       = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    std::vector<int> executions{};
+    for (int i = 0; i < 3; ++i)
+        worker.schedule([&, i](const auto&) {executions.push_back(i); return rpp::schedulers::optional_delay_from_now{}; }, obs);
+    worker.schedule(std::chrono::hours{1}, [&](const auto&) {executions.push_back(-1); return rpp::schedulers::optional_delay_from_now{}; }, obs);
+
+    scheduler.dispatch_if_ready();
+    CHECK(executions == std::vector{0, 1});
+
+    scheduler.dispatch_if_ready();
+    CHECK(executions == std::vector{0, 1, 2});
+
+    scheduler.dispatch_if_ready();
+    CHECK(executions == std::vector{0, 1, 2});
+    CHECK(scheduler.is_empty() == false);
+    CHECK(scheduler.is_any_ready_schedulable() == false);
+}
+
 TEST_CASE("run_loop scheduler dispatches tasks only manually")
 {
     auto scheduler = rpp::schedulers::run_loop{};
@@ -1016,3 +1207,1451 @@ TEST_CASE("thread_pool shares same thread")
 
     CHECK(f.get());
 }
+
+TEST_CASE("thread_pool applies placement options to its threads")
+{
+    auto obs = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    rpp::schedulers::thread_pool::options options{};
+    options.threads_count      = 2;
+    options.affinity           = {{0}};
+    options.thread_name_prefix = "rpp_pool_";
+
+    const auto get_placement = [&obs](const auto& scheduler) {
+        std::promise<std::pair<int, std::string>> promise{};
+        scheduler.create_worker().schedule([&promise](const auto&) {
+            std::string name{};
+#if defined(__linux__)
+            char buffer[16]{};
+            pthread_getname_np(pthread_self(), buffer, sizeof(buffer));
+            name = buffer;
+            promise.set_value({sched_getcpu(), name});
+#else
+            promise.set_value({0, name});
+#endif
+            return rpp::schedulers::optional_delay_from_now{};
+        },
+                                           obs);
+        return promise.get_future().get();
+    };
+
+    for (const auto mode : {rpp::schedulers::thread_pool::mode::pinned, rpp::schedulers::thread_pool::mode::work_stealing})
+    {
+        options.pool_mode = mode;
+        const auto scheduler = rpp::schedulers::thread_pool{options};
+        for (size_t i = 0; i < 4; ++i)
+        {
+            const auto [cpu, name] = get_placement(scheduler);
+#if defined(__linux__)
+            CHECK(cpu == 0);
+            CHECK(name.starts_with("rpp_pool_"));
+#endif
+        }
+    }
+}
+
+TEST_CASE("numa topology helpers")
+{
+    CHECK(rpp::schedulers::details::parse_cpu_list("0-3,8,10-11\n") == std::vector<size_t>{0, 1, 2, 3, 8, 10, 11});
+    CHECK(rpp::schedulers::details::parse_cpu_list("") == std::vector<size_t>{});
+
+    const auto& nodes = rpp::schedulers::details::get_numa_nodes();
+    REQUIRE(!nodes.empty());
+    for (const auto& node : nodes)
+        CHECK(!node.empty());
+    CHECK(rpp::schedulers::details::get_current_numa_node() < nodes.size());
+}
+
+TEST_CASE("computational can't be configured after creation of pool")
+{
+    rpp::schedulers::computational::create_worker();
+
+    CHECK_THROWS_AS(rpp::schedulers::computational::configure(2), std::logic_error);
+}
+
+TEST_CASE("thread_pool with work_stealing mode")
+{
+    auto obs = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    auto scheduler = rpp::schedulers::thread_pool{2, rpp::schedulers::thread_pool::mode::work_stealing};
+
+    SUBCASE("other workers are not blocked by long-running schedulable")
+    {
+        std::atomic_bool   first_job_done{};
+        std::promise<void> first_job_finished{};
+
+        scheduler.create_worker().schedule([&first_job_done, &first_job_finished](const auto&) {
+            while (!first_job_done)
+                std::this_thread::yield();
+            first_job_finished.set_value();
+            return rpp::schedulers::optional_delay_from_now{};
+        },
+                                           obs);
+
+        std::promise<bool> second_task_executed_promise{};
+        std::promise<bool> third_task_executed_promise{};
+        scheduler.create_worker().schedule([&second_task_executed_promise](const auto&) {
+            second_task_executed_promise.set_value(true);
+            return rpp::schedulers::optional_delay_from_now{};
+        },
+                                           obs);
+        scheduler.create_worker().schedule([&third_task_executed_promise](const auto&) {
+            third_task_executed_promise.set_value(true);
+            return rpp::schedulers::optional_delay_from_now{};
+        },
+                                           obs);
+
+        CHECK(second_task_executed_promise.get_future().wait_for(std::chrono::seconds{5}) == std::future_status::ready);
+        CHECK(third_task_executed_promise.get_future().wait_for(std::chrono::seconds{5}) == std::future_status::ready);
+        first_job_done.store(true);
+        first_job_finished.get_future().wait();
+    }
+
+    SUBCASE("schedulables of same worker are serialized and keep order")
+    {
+        auto worker = scheduler.create_worker();
+
+        std::atomic_int    in_progress{};
+        std::atomic_bool   overlapped{};
+        std::vector<int>   executions{};
+        std::promise<void> done{};
+
+        for (int i = 0; i < 100; ++i)
+        {
+            worker.schedule([&, i](const auto&) {
+                if (in_progress.fetch_add(1) != 0)
+                    overlapped.store(true);
+                executions.push_back(i);
+                in_progress.fetch_sub(1);
+                if (i == 99)
+                    done.set_value();
+                return rpp::schedulers::optional_delay_from_now{};
+            },
+                            obs);
+        }
+
+        done.get_future().wait();
+        CHECK(!overlapped.load());
+        CHECK(executions.size() == 100);
+        CHECK(std::is_sorted(executions.begin(), executions.end()));
+    }
+
+    SUBCASE("scheduler respects to time point")
+    {
+        auto worker = scheduler.create_worker();
+
+        std::vector<int>   executions{};
+        std::promise<void> done{};
+        worker.schedule(std::chrono::milliseconds{30}, [&](const auto&) {executions.push_back(3); done.set_value(); return rpp::schedulers::optional_delay_from_now{}; }, obs);
+        worker.schedule(std::chrono::milliseconds{10}, [&](const auto&) {executions.push_back(1); return rpp::schedulers::optional_delay_from_now{}; }, obs);
+        worker.schedule(std::chrono::milliseconds{20}, [&](const auto&) {executions.push_back(2); return rpp::schedulers::optional_delay_from_now{}; }, obs);
+
+        done.get_future().wait();
+        CHECK(executions == std::vector{1, 2, 3});
+    }
+
+    SUBCASE("current_thread inside work_stealing thread_pool defers execution")
+    {
+        std::promise<bool> promise{};
+        std::atomic_bool   inner_executed{};
+        scheduler.create_worker().schedule([&promise, &inner_executed](const auto& obs) {
+            rpp::schedulers::current_thread::create_worker().schedule([&promise, &inner_executed](const auto&) {
+                promise.set_value(inner_executed.load());
+                return rpp::schedulers::optional_delay_from_now{};
+            },
+                                                                      obs);
+            inner_executed = true;
+            return rpp::schedulers::optional_delay_from_now{};
+        },
+                                           obs);
+
+        CHECK(promise.get_future().get());
+    }
+}
+
+TEST_CASE("schedulables_allocator recycles memory")
+{
+    using allocator = rpp::schedulers::details::schedulables_allocator;
+
+    SUBCASE("block deallocated in the same thread is reused")
+    {
+        void* first = allocator::allocate(100);
+        allocator::deallocate(first, 100);
+
+        void* second = allocator::allocate(90);
+        CHECK(first == second);
+        allocator::deallocate(second, 90);
+    }
+
+    SUBCASE("blocks deallocated in other thread are reused")
+    {
+        std::vector<void*> blocks{};
+        for (size_t i = 0; i < 1000; ++i)
+            blocks.push_back(allocator::allocate(500));
+
+        std::thread{[&blocks] {
+            for (void* block : blocks)
+                allocator::deallocate(block, 500);
+        }}.join();
+
+        void* reused = allocator::allocate(500);
+        CHECK(std::find(blocks.begin(), blocks.end(), reused) != blocks.end());
+        allocator::deallocate(reused, 500);
+    }
+
+    SUBCASE("huge blocks are served by heap")
+    {
+        void* block = allocator::allocate(4096);
+        CHECK(block != nullptr);
+        allocator::deallocate(block, 4096);
+    }
+}
+
+TEST_CASE("schedulable is destroyed once last reference is released")
+{
+    auto obs = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    std::shared_ptr<int> counter = std::make_shared<int>();
+
+    auto queue = rpp::schedulers::details::schedulables_queue<rpp::schedulers::current_thread::worker_strategy>{};
+    queue.emplace(rpp::schedulers::time_point{}, [counter](const auto&) { return rpp::schedulers::optional_delay_from_now{}; }, obs);
+    CHECK(counter.use_count() == 2);
+
+    auto copy = queue.top();
+    queue.pop();
+    CHECK(queue.is_empty());
+    CHECK(counter.use_count() == 2);
+
+    copy = {};
+    CHECK(counter.use_count() == 1);
+}
+
+TEST_CASE("new_thread and run_loop handle concurrent submissions from many threads")
+{
+    auto obs = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    constexpr size_t threads_count     = 4;
+    constexpr size_t items_per_thread  = 1000;
+    constexpr size_t total_items_count = threads_count * items_per_thread;
+
+    const auto submit_from_threads = [&](const auto& worker, std::atomic_size_t& executed) {
+        std::vector<std::thread> threads{};
+        for (size_t i = 0; i < threads_count; ++i)
+        {
+            threads.emplace_back([&] {
+                for (size_t j = 0; j < items_per_thread; ++j)
+                {
+                    worker.schedule([&executed](const auto&) {
+                        executed.fetch_add(1);
+                        return rpp::schedulers::optional_delay_from_now{};
+                    },
+                                    obs);
+                }
+            });
+        }
+        for (auto& t : threads)
+            t.join();
+    };
+
+    SUBCASE("new_thread")
+    {
+        std::atomic_size_t executed{};
+        std::promise<void> done{};
+        {
+            const auto worker = rpp::schedulers::new_thread::create_worker();
+            submit_from_threads(worker, executed);
+            worker.schedule([&done](const auto&) {
+                done.set_value();
+                return rpp::schedulers::optional_delay_from_now{};
+            },
+                            obs);
+        }
+
+        CHECK(done.get_future().wait_for(std::chrono::seconds{10}) == std::future_status::ready);
+        CHECK(executed.load() == total_items_count);
+    }
+
+    SUBCASE("new_thread wakes up parked thread for delayed schedulable")
+    {
+        const auto         worker = rpp::schedulers::new_thread::create_worker();
+        std::promise<void> done{};
+        std::this_thread::sleep_for(std::chrono::milliseconds{10});
+
+        worker.schedule(std::chrono::milliseconds{10}, [&done](const auto&) {
+            done.set_value();
+            return rpp::schedulers::optional_delay_from_now{};
+        },
+                        obs);
+
+        CHECK(done.get_future().wait_for(std::chrono::seconds{10}) == std::future_status::ready);
+    }
+
+    SUBCASE("run_loop")
+    {
+        std::atomic_size_t              executed{};
+        const rpp::schedulers::run_loop run_loop{};
+
+        std::thread dispatcher{[&] {
+            while (executed.load() != total_items_count)
+                run_loop.dispatch();
+        }};
+
+        submit_from_threads(run_loop.create_worker(), executed);
+        dispatcher.join();
+
+        CHECK(executed.load() == total_items_count);
+        CHECK(run_loop.is_empty());
+    }
+}
+
+#if defined(__linux__)
+TEST_CASE("epoll_loop dispatches schedulables and file descriptors")
+{
+    const rpp::schedulers::epoll_loop loop{};
+    auto                              worker = loop.create_worker();
+    auto                              obs    = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    SUBCASE("schedulables respect time_point and trampoline current_thread")
+    {
+        std::vector<int> executions{};
+        worker.schedule(std::chrono::milliseconds{5}, [&](const auto&) { executions.push_back(3); return rpp::schedulers::optional_delay_from_now{}; }, obs);
+        worker.schedule([&](const auto& handler) {
+            executions.push_back(1);
+            rpp::schedulers::current_thread::create_worker().schedule([&](const auto&) { executions.push_back(2); return rpp::schedulers::optional_delay_from_now{}; }, handler);
+            CHECK(executions == std::vector{1});
+            return rpp::schedulers::optional_delay_from_now{};
+        },
+                        obs);
+
+        const auto start = std::chrono::steady_clock::now();
+        while (!loop.is_empty())
+            loop.dispatch();
+
+        CHECK(executions == std::vector{1, 2, 3});
+        CHECK(std::chrono::steady_clock::now() - start >= std::chrono::milliseconds{5});
+    }
+
+    SUBCASE("submission from other thread wakes up blocked dispatch")
+    {
+        std::atomic_bool executed{};
+        auto             t = std::thread{[&] {
+            std::this_thread::sleep_for(std::chrono::milliseconds{50});
+            worker.schedule([&](const auto&) { executed = true; return rpp::schedulers::optional_delay_from_now{}; }, obs);
+        }};
+
+        while (!executed)
+            loop.dispatch();
+        t.join();
+    }
+
+    SUBCASE("run returns after stop")
+    {
+        worker.schedule(std::chrono::milliseconds{1}, [&](const auto&) { loop.stop(); return rpp::schedulers::optional_delay_from_now{}; }, obs);
+        loop.run();
+        CHECK(loop.is_empty());
+    }
+
+    SUBCASE("observe_fd emits readiness of descriptor till dispose")
+    {
+        int fds[2]{};
+        REQUIRE(::pipe(fds) == 0);
+
+        auto mock = mock_observer_strategy<rpp::schedulers::fd_events>{};
+        auto d    = rpp::composite_disposable_wrapper::make();
+        loop.observe_fd(fds[0], rpp::schedulers::fd_events::readable).subscribe(mock.get_observer(d));
+
+        loop.dispatch_if_ready();
+        CHECK(mock.get_received_values().empty());
+
+        const char value = 'a';
+        REQUIRE(::write(fds[1], &value, 1) == 1);
+        loop.dispatch();
+        CHECK(mock.get_received_values() == std::vector{rpp::schedulers::fd_events::readable});
+
+        d.dispose();
+        loop.dispatch_if_ready();
+        loop.dispatch_if_ready();
+        CHECK(mock.get_received_values().size() == 1);
+
+        ::close(fds[0]);
+        ::close(fds[1]);
+    }
+
+    SUBCASE("observe_fd reports half-closed connection of peer as hangup")
+    {
+        int fds[2]{};
+        REQUIRE(::socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0);
+
+        auto mock = mock_observer_strategy<rpp::schedulers::fd_events>{};
+        auto d    = rpp::composite_disposable_wrapper::make();
+        loop.observe_fd(fds[0], rpp::schedulers::fd_events::readable).subscribe(mock.get_observer(d));
+
+        loop.dispatch_if_ready();
+        REQUIRE(::shutdown(fds[1], SHUT_WR) == 0);
+        loop.dispatch();
+        REQUIRE(mock.get_received_values().size() == 1);
+        CHECK((mock.get_received_values()[0] & rpp::schedulers::fd_events::hangup) == rpp::schedulers::fd_events::hangup);
+
+        d.dispose();
+        ::close(fds[0]);
+        ::close(fds[1]);
+    }
+
+    SUBCASE("observe_fd reports error for unsupported descriptor")
+    {
+        auto mock = mock_observer_strategy<rpp::schedulers::fd_events>{};
+        loop.observe_fd(-1).subscribe(mock.get_observer());
+
+        loop.dispatch_if_ready();
+        CHECK(mock.get_on_error_count() == 1);
+    }
+}
+#endif
+
+TEST_CASE("schedulers instrumentation collects statistics only when enabled")
+{
+    using rpp::schedulers::instrumentation::scheduler_kind;
+
+    auto obs = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+    rpp::schedulers::instrumentation::reset_statistics();
+
+    const rpp::schedulers::run_loop loop{};
+    auto                            worker = loop.create_worker();
+    auto                            d      = rpp::composite_disposable_wrapper::make();
+    worker.schedule([](const auto&) { std::this_thread::sleep_for(std::chrono::milliseconds{1}); return rpp::schedulers::optional_delay_from_now{}; }, obs);
+    worker.schedule([](const auto&) { return rpp::schedulers::optional_delay_from_now{}; }, mock_observer_strategy<int>{}.get_observer(d).as_dynamic());
+    d.dispose();
+
+    while (!loop.is_empty())
+        loop.dispatch();
+
+    const auto stats = rpp::schedulers::instrumentation::get_statistics(scheduler_kind::run_loop);
+    if constexpr (rpp::schedulers::instrumentation::is_enabled)
+    {
+        CHECK(stats.executed == 1);
+        CHECK(stats.disposed_skipped == 1);
+        CHECK(stats.max_queue_depth == 2);
+        CHECK(stats.lag.count == 1);
+        CHECK(stats.execution.count == 1);
+        CHECK(stats.execution.max >= std::chrono::milliseconds{1});
+        CHECK(stats.execution.buckets[0] == 0);
+    }
+    else
+    {
+        CHECK(stats.executed == 0);
+        CHECK(stats.execution.count == 0);
+        CHECK(rpp::schedulers::details::schedulables_queue<rpp::schedulers::current_thread::worker_strategy>{}.size() == 0);
+    }
+
+    rpp::schedulers::instrumentation::reset_statistics();
+    CHECK(rpp::schedulers::instrumentation::get_statistics(scheduler_kind::run_loop).executed == 0);
+}
+
+TEST_CASE("schedulers instrumentation records each re-execution in place separately")
+{
+    using rpp::schedulers::instrumentation::scheduler_kind;
+
+    auto obs = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+    rpp::schedulers::instrumentation::reset_statistics();
+
+    const auto worker = rpp::schedulers::current_thread::create_worker();
+    size_t     count{};
+    // outer schedulable owns queue of current_thread, so nested one is executed from the queue
+    worker.schedule([&](const auto&) {
+        worker.schedule([&count](const auto&) {
+            return ++count < 3 ? rpp::schedulers::optional_delay_from_now{rpp::schedulers::duration{}} : std::nullopt;
+        },
+                        obs);
+        return rpp::schedulers::optional_delay_from_now{};
+    },
+                    obs);
+
+    const auto stats = rpp::schedulers::instrumentation::get_statistics(scheduler_kind::current_thread);
+    CHECK(count == 3);
+    if constexpr (rpp::schedulers::instrumentation::is_enabled)
+    {
+        CHECK(stats.executed == 3);
+        CHECK(stats.execution.count == 3);
+        CHECK(stats.lag.count == 1);
+    }
+    else
+    {
+        CHECK(stats.executed == 0);
+    }
+
+    rpp::schedulers::instrumentation::reset_statistics();
+}
+
+TEST_CASE("schedulers with spinning idle strategy process all schedulables")
+{
+    auto obs = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    const rpp::schedulers::idle_strategy idle{.spin_count = 10000, .yield_count = 100};
+
+    const auto check = [&](const auto& worker) {
+        constexpr size_t    count = 100;
+        std::atomic<size_t> executed{};
+        std::promise<void>  done{};
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (i % 10 == 0)
+                std::this_thread::sleep_for(std::chrono::microseconds{100});
+
+            worker.schedule(std::chrono::microseconds{i % 3 * 50}, [&](const auto&) {
+                if (executed.fetch_add(1) + 1 == count)
+                    done.set_value();
+                return rpp::schedulers::optional_delay_from_now{};
+            },
+                            obs);
+        }
+        done.get_future().get();
+        CHECK(executed.load() == count);
+    };
+
+    SUBCASE("new_thread")
+    {
+        check(rpp::schedulers::new_thread::create_worker(idle));
+    }
+
+    SUBCASE("thread_pool")
+    {
+        for (const auto mode : {rpp::schedulers::thread_pool::mode::pinned, rpp::schedulers::thread_pool::mode::work_stealing})
+        {
+            rpp::schedulers::thread_pool::options options{};
+            options.threads_count = 2;
+            options.pool_mode     = mode;
+            options.idle          = idle;
+            check(rpp::schedulers::thread_pool{options}.create_worker());
+        }
+    }
+}
+
+TEST_CASE("timer slack coalesces close timers into single wake-up")
+{
+    auto obs = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    const auto noop = [](const auto&) { return rpp::schedulers::optional_delay_from_now{}; };
+
+    SUBCASE("queue calculates wake-up time_point")
+    {
+        for (const auto backend : {rpp::schedulers::queue_backend::linked_list, rpp::schedulers::queue_backend::heap})
+        {
+            rpp::schedulers::details::schedulables_queue<rpp::schedulers::current_thread::worker_strategy> queue{backend};
+            CHECK(queue.get_wakeup_timepoint(std::chrono::milliseconds{2}) == rpp::schedulers::time_point::max());
+
+            const auto start = rpp::schedulers::clock_type::now() + std::chrono::hours{1};
+            queue.emplace(start + std::chrono::milliseconds{5}, noop, obs);
+            queue.emplace(start + std::chrono::milliseconds{1}, noop, obs);
+            queue.emplace(start, noop, obs);
+
+            CHECK(queue.get_wakeup_timepoint({}) == start);
+            CHECK(queue.get_wakeup_timepoint(std::chrono::milliseconds{2}) == start + std::chrono::milliseconds{2});
+            CHECK(queue.get_wakeup_timepoint(std::chrono::milliseconds{10}) == start + std::chrono::milliseconds{10});
+
+            {
+                const rpp::schedulers::details::timer_slack_scope _{rpp::schedulers::duration::zero()};
+                queue.emplace(start + std::chrono::microseconds{500}, noop, obs);
+            }
+            CHECK(queue.get_wakeup_timepoint(std::chrono::milliseconds{2}) == start + std::chrono::microseconds{500});
+        }
+    }
+
+    SUBCASE("run_loop serves timers within slack by one dispatch")
+    {
+        rpp::schedulers::run_loop loop{rpp::schedulers::queue_backend::linked_list, 10, std::chrono::milliseconds{20}};
+        const auto                worker = loop.create_worker();
+
+        std::vector<int> executions{};
+        const auto       push = [&](int v) {
+            return [&executions, v](const auto&) {
+                executions.push_back(v);
+                return rpp::schedulers::optional_delay_from_now{};
+            };
+        };
+
+        worker.schedule(std::chrono::milliseconds{1}, push(1), obs);
+        worker.schedule(std::chrono::milliseconds{5}, push(2), obs);
+
+        loop.dispatch();
+        CHECK(executions == std::vector{1, 2});
+
+        SUBCASE("precise schedulable is not delayed")
+        {
+            worker.schedule(rpp::schedulers::timer_slack{}, std::chrono::milliseconds{1}, push(3), obs);
+            worker.schedule(std::chrono::milliseconds{200}, push(4), obs);
+
+            loop.dispatch();
+            CHECK(executions == std::vector{1, 2, 3});
+        }
+    }
+
+    SUBCASE("new_thread delays timer to serve next one together")
+    {
+        rpp::schedulers::new_thread::options options{};
+        options.timer_slack = std::chrono::milliseconds{20};
+        const auto worker   = rpp::schedulers::new_thread::create_worker(options);
+
+        std::promise<rpp::schedulers::time_point> first{};
+        std::promise<void>                        second{};
+
+        const auto start = rpp::schedulers::clock_type::now();
+        worker.schedule(start + std::chrono::milliseconds{1}, [&](const auto&) {
+            first.set_value(rpp::schedulers::clock_type::now());
+            return rpp::schedulers::optional_delay_from_now{};
+        },
+                        obs);
+        worker.schedule(start + std::chrono::milliseconds{5}, [&](const auto&) {
+            second.set_value();
+            return rpp::schedulers::optional_delay_from_now{};
+        },
+                        obs);
+
+        CHECK(first.get_future().get() >= start + std::chrono::milliseconds{5});
+        second.get_future().wait();
+    }
+}
+
+namespace
+{
+    template<typename Scheduler>
+    concept accepts_priority_and_timer_slack = requires(const rpp::schedulers::utils::get_worker_t<Scheduler>& worker, const rpp::schedulers::details::fake_schedulable_handler& handler) {
+        worker.schedule(rpp::schedulers::priority::high, rpp::schedulers::duration{}, std::declval<rpp::schedulers::optional_delay_from_now (*)(const rpp::schedulers::details::fake_schedulable_handler&)>(), handler);
+        worker.schedule(rpp::schedulers::timer_slack{}, rpp::schedulers::duration{}, std::declval<rpp::schedulers::optional_delay_from_now (*)(const rpp::schedulers::details::fake_schedulable_handler&)>(), handler);
+    };
+} // namespace
+
+TEST_CASE("priority and timer slack are accepted only by queue-based schedulers")
+{
+    static_assert(accepts_priority_and_timer_slack<rpp::schedulers::current_thread>);
+    static_assert(accepts_priority_and_timer_slack<rpp::schedulers::new_thread>);
+    static_assert(accepts_priority_and_timer_slack<rpp::schedulers::run_loop>);
+    static_assert(accepts_priority_and_timer_slack<rpp::schedulers::thread_pool>);
+    static_assert(accepts_priority_and_timer_slack<rpp::schedulers::io>);
+    static_assert(accepts_priority_and_timer_slack<rpp::schedulers::test_scheduler>);
+
+    static_assert(!accepts_priority_and_timer_slack<rpp::schedulers::immediate>);
+    static_assert(!accepts_priority_and_timer_slack<rpp::schedulers::edf_thread>);
+    static_assert(!accepts_priority_and_timer_slack<rpp::schedulers::simulation_scheduler>);
+}
+
+TEST_CASE("schedulables with higher priority are executed first among due ones")
+{
+    auto obs = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    std::vector<std::string> executions{};
+    const auto               push = [&](std::string v) {
+        return [&executions, v](const auto&) {
+            executions.push_back(v);
+            return rpp::schedulers::optional_delay_from_now{};
+        };
+    };
+
+    SUBCASE("queue keeps FIFO order inside of priority")
+    {
+        for (const auto backend : {rpp::schedulers::queue_backend::linked_list, rpp::schedulers::queue_backend::heap})
+        {
+            executions.clear();
+            rpp::schedulers::details::schedulables_queue<rpp::schedulers::current_thread::worker_strategy> queue{backend};
+
+            const auto now = rpp::schedulers::details::now();
+            const auto emplace = [&](rpp::schedulers::priority p, rpp::schedulers::time_point tp, std::string v) {
+                const rpp::schedulers::details::priority_scope _{p};
+                queue.emplace(tp, push(std::move(v)), obs);
+            };
+
+            emplace(rpp::schedulers::priority::low, now - std::chrono::seconds{3}, "low_1");
+            emplace(rpp::schedulers::priority::normal, now - std::chrono::seconds{2}, "normal_1");
+            emplace(rpp::schedulers::priority::low, now - std::chrono::seconds{2}, "low_2");
+            emplace(rpp::schedulers::priority::high, now - std::chrono::seconds{1}, "high_1");
+            emplace(rpp::schedulers::priority::normal, now - std::chrono::seconds{1}, "normal_2");
+            emplace(rpp::schedulers::priority::high, now + std::chrono::hours{1}, "high_future");
+
+            while (!queue.is_empty() && queue.top()->get_timepoint() <= now)
+                (*queue.pop())();
+
+            CHECK(executions == std::vector<std::string>{"high_1", "normal_1", "normal_2", "low_1", "low_2"});
+            CHECK(queue.top()->get_priority() == rpp::schedulers::priority::high);
+        }
+    }
+
+    SUBCASE("starvation limit lets earlier lower priority schedulable run")
+    {
+        rpp::schedulers::details::schedulables_queue<rpp::schedulers::current_thread::worker_strategy> queue{rpp::schedulers::queue_backend::linked_list, 2};
+
+        const auto now = rpp::schedulers::details::now();
+        {
+            const rpp::schedulers::details::priority_scope _{rpp::schedulers::priority::low};
+            queue.emplace(now - std::chrono::seconds{2}, push("low"), obs);
+        }
+        for (size_t i = 0; i < 4; ++i)
+            queue.emplace(now - std::chrono::seconds{1}, push("normal"), obs);
+
+        while (!queue.is_empty())
+            (*queue.pop())();
+
+        CHECK(executions == std::vector<std::string>{"normal", "normal", "low", "normal", "normal"});
+    }
+
+    SUBCASE("queue with own clock prefers higher priority only among due schedulables")
+    {
+        rpp::schedulers::details::now();
+        rpp::schedulers::details::schedulables_queue<rpp::schedulers::test_scheduler::worker_strategy> queue{};
+
+        const auto now = rpp::schedulers::test_scheduler::now();
+        queue.emplace(now + std::chrono::seconds{1}, push("normal"), obs);
+        {
+            const rpp::schedulers::details::priority_scope _{rpp::schedulers::priority::high};
+            queue.emplace(now + std::chrono::seconds{5}, push("high"), obs);
+        }
+
+        while (!queue.is_empty())
+            (*queue.pop())();
+
+        CHECK(executions == std::vector<std::string>{"normal", "high"});
+    }
+
+    SUBCASE("run_loop serves heartbeat before flood of emissions")
+    {
+        rpp::schedulers::run_loop loop{};
+        const auto                worker = loop.create_worker();
+
+        for (size_t i = 0; i < 3; ++i)
+            worker.schedule(push("data"), obs);
+        worker.schedule(rpp::schedulers::priority::high, rpp::schedulers::duration{}, push("heartbeat"), obs);
+
+        while (loop.is_any_ready_schedulable())
+            loop.dispatch_if_ready();
+
+        CHECK(executions == std::vector<std::string>{"heartbeat", "data", "data", "data"});
+    }
+
+    SUBCASE("priority is kept for re-schedules")
+    {
+        const auto worker = rpp::schedulers::current_thread::create_worker();
+        size_t     count{};
+        worker.schedule([&](const auto&) {
+            worker.schedule([&](const auto&) {
+                executions.push_back("data");
+                return ++count < 3 ? rpp::schedulers::optional_delay_from_now{rpp::schedulers::duration{}} : std::nullopt;
+            },
+                            obs);
+            worker.schedule(rpp::schedulers::priority::low, rpp::schedulers::duration{}, push("low"), obs);
+            return rpp::schedulers::optional_delay_from_now{};
+        },
+                        obs);
+
+        CHECK(executions == std::vector<std::string>{"data", "data", "data", "low"});
+    }
+}
+
+TEST_CASE("run_loop dispatches schedulables within time budget")
+{
+    auto obs = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    rpp::schedulers::run_loop::options options{};
+    options.max_batch_size = 4;
+    rpp::schedulers::run_loop loop{options};
+    const auto                worker = loop.create_worker();
+
+    size_t     executed{};
+    const auto fn = [&](const auto&) {
+        ++executed;
+        return rpp::schedulers::optional_delay_from_now{};
+    };
+
+    for (size_t i = 0; i < 10; ++i)
+        worker.schedule(fn, obs);
+    worker.schedule(std::chrono::hours{1}, fn, obs);
+
+    SUBCASE("expired deadline executes nothing")
+    {
+        const auto res = loop.dispatch_until(rpp::schedulers::clock_type::now() - std::chrono::seconds{1});
+        CHECK(res.executed == 0);
+        CHECK(res.remaining == 11);
+        CHECK(executed == 0);
+    }
+
+    SUBCASE("enough budget executes all ready schedulables")
+    {
+        const auto res = loop.dispatch_for(std::chrono::hours{1});
+        CHECK(res.executed == 10);
+        CHECK(res.remaining == 1);
+        CHECK(executed == 10);
+    }
+
+    SUBCASE("budget is checked once per batch")
+    {
+        const rpp::schedulers::run_loop single{};
+        single.create_worker().schedule([&](const auto&) {
+            std::this_thread::sleep_for(std::chrono::milliseconds{10});
+            return rpp::schedulers::optional_delay_from_now{};
+        },
+                                        obs);
+        single.create_worker().schedule(fn, obs);
+
+        SUBCASE("batch of single schedulable")
+        {
+            const auto res = single.dispatch_for(std::chrono::milliseconds{1}, 1);
+            CHECK(res.executed == 1);
+            CHECK(res.remaining == 1);
+            CHECK(executed == 0);
+        }
+
+        SUBCASE("default batch doesn't depend on max_batch_size of loop")
+        {
+            const auto res = single.dispatch_for(std::chrono::milliseconds{1});
+            CHECK(res.executed == 2);
+            CHECK(res.remaining == 0);
+            CHECK(executed == 1);
+        }
+    }
+
+    SUBCASE("disposed schedulables are not counted as executed")
+    {
+        auto d = rpp::composite_disposable_wrapper::make();
+        auto disposable_obs = mock_observer_strategy<int>{}.get_observer(d).as_dynamic();
+        worker.schedule(fn, disposable_obs);
+        d.dispose();
+
+        const auto res = loop.dispatch_for(std::chrono::hours{1});
+        CHECK(res.executed == 10);
+        CHECK(res.remaining == 1);
+    }
+}
+
+TEST_CASE("simulation_scheduler replays virtual timeline")
+{
+    auto obs = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    SUBCASE("virtual clock jumps to deadlines of many workers")
+    {
+        const rpp::schedulers::simulation_scheduler scheduler{};
+        const auto                                  start = scheduler.now();
+
+        for (size_t i = 0; i < 3; ++i)
+        {
+            scheduler.create_worker().schedule(std::chrono::seconds{1}, [](const auto&) {
+                return rpp::schedulers::optional_delay_from_this_timepoint{std::chrono::seconds{1}};
+            },
+                                               obs);
+        }
+
+        scheduler.run_for(std::chrono::hours{1});
+
+        const auto stats = scheduler.get_statistics();
+        CHECK(scheduler.now() == start + std::chrono::hours{1});
+        CHECK(stats.executed == 3 * 3600);
+        CHECK(stats.simulated_time == std::chrono::hours{1});
+        CHECK(std::abs(stats.get_throughput() - 3.0) < 1e-9);
+        CHECK(stats.latency.max == rpp::schedulers::duration::zero());
+        CHECK(stats.max_queue_depth == 3);
+        CHECK(scheduler.get_events().empty());
+        CHECK(!scheduler.is_empty());
+    }
+
+    SUBCASE("busy worker delays due schedulables")
+    {
+        const rpp::schedulers::simulation_scheduler scheduler{rpp::schedulers::simulation_scheduler::options{.execution_cost = std::chrono::milliseconds{10}, .record_events = true}};
+        const auto                                  worker = scheduler.create_worker();
+        const auto                                  other  = scheduler.create_worker();
+        const auto                                  start  = scheduler.now();
+
+        std::vector<int> order{};
+        for (int i = 0; i < 3; ++i)
+        {
+            worker.schedule([&order, i](const auto&) {
+                order.push_back(i);
+                return rpp::schedulers::optional_delay_from_now{};
+            },
+                            obs);
+        }
+        other.schedule([&order](const auto&) {
+            order.push_back(10);
+            return rpp::schedulers::optional_delay_from_now{};
+        },
+                       obs);
+
+        scheduler.run();
+
+        CHECK(order == std::vector{0, 10, 1, 2});
+        const auto& events = scheduler.get_events();
+        REQUIRE(events.size() == 4);
+        CHECK(events[2].worker_id == 0);
+        CHECK(events[2].executed == start + std::chrono::milliseconds{10});
+        CHECK(events[3].executed == start + std::chrono::milliseconds{20});
+        CHECK(scheduler.get_statistics().latency.max == std::chrono::milliseconds{20});
+        CHECK(scheduler.is_empty());
+    }
+
+    SUBCASE("time-based operators work in virtual time")
+    {
+        const rpp::schedulers::simulation_scheduler scheduler{};
+        const auto                                  start = scheduler.now();
+
+        std::vector<size_t> values{};
+        rpp::source::interval(std::chrono::minutes{1}, scheduler)
+            | rpp::ops::take(60)
+            | rpp::ops::debounce(std::chrono::seconds{30}, scheduler)
+            | rpp::ops::subscribe([&](size_t v) { values.push_back(v); });
+
+        scheduler.run();
+
+        CHECK(values.size() == 60);
+        CHECK(scheduler.now() >= start + std::chrono::hours{1});
+    }
+
+    SUBCASE("each simulation keeps own virtual clock")
+    {
+        const auto fn    = [](const auto&) { return rpp::schedulers::optional_delay_from_now{}; };
+        const auto start = rpp::schedulers::time_point{std::chrono::hours{10}};
+
+        const rpp::schedulers::simulation_scheduler first{rpp::schedulers::simulation_scheduler::options{.start = start, .record_events = true}};
+        const auto                                  worker = first.create_worker();
+        first.run_for(std::chrono::minutes{1});
+
+        const rpp::schedulers::simulation_scheduler second{rpp::schedulers::simulation_scheduler::options{.record_events = true}};
+        second.create_worker().schedule(std::chrono::minutes{5}, fn, obs);
+        worker.schedule(std::chrono::minutes{1}, fn, obs);
+
+        first.run();
+        second.run();
+
+        CHECK(first.now() == start + std::chrono::minutes{2});
+        CHECK(second.now() == rpp::schedulers::time_point{} + std::chrono::minutes{5});
+        REQUIRE(first.get_events().size() == 1);
+        CHECK(first.get_events()[0].executed == start + std::chrono::minutes{2});
+        REQUIRE(second.get_events().size() == 1);
+        CHECK(second.get_events()[0].executed == rpp::schedulers::time_point{} + std::chrono::minutes{5});
+    }
+
+    SUBCASE("static now reports clock of simulation executing schedulable")
+    {
+        using worker_t   = rpp::schedulers::utils::get_worker_t<rpp::schedulers::simulation_scheduler>;
+        const auto start = rpp::schedulers::time_point{std::chrono::hours{10}};
+
+        const rpp::schedulers::simulation_scheduler first{rpp::schedulers::simulation_scheduler::options{.start = start}};
+        const auto                                  worker = first.create_worker();
+
+        const rpp::schedulers::simulation_scheduler second{};
+        const auto                                  other = second.create_worker();
+        CHECK(worker_t::now() == second.now());
+
+        std::vector<rpp::schedulers::time_point> values{};
+        worker.schedule(std::chrono::minutes{1}, [&](const auto&) {
+            values.push_back(worker_t::now());
+            other.schedule(std::chrono::minutes{1}, [&](const auto&) {
+                values.push_back(worker_t::now());
+                return rpp::schedulers::optional_delay_from_now{};
+            },
+                           obs);
+            second.run();
+            values.push_back(worker_t::now());
+            return rpp::schedulers::optional_delay_from_now{};
+        },
+                        obs);
+        first.run();
+
+        CHECK(values == std::vector{start + std::chrono::minutes{1}, rpp::schedulers::time_point{} + std::chrono::minutes{1}, start + std::chrono::minutes{1}});
+        CHECK(worker_t::now() == second.now());
+    }
+
+    SUBCASE("ids of destroyed workers are reused after their schedulables")
+    {
+        const auto fn = [](const auto&) { return rpp::schedulers::optional_delay_from_now{}; };
+
+        const rpp::schedulers::simulation_scheduler scheduler{rpp::schedulers::simulation_scheduler::options{.record_events = true}};
+        scheduler.create_worker().schedule(std::chrono::seconds{1}, fn, obs);
+        scheduler.create_worker().schedule(std::chrono::seconds{2}, fn, obs);
+
+        scheduler.run();
+        scheduler.create_worker().schedule(std::chrono::seconds{1}, fn, obs);
+        scheduler.create_worker().schedule(std::chrono::seconds{1}, fn, obs);
+        scheduler.create_worker().schedule(std::chrono::seconds{1}, fn, obs);
+        scheduler.run();
+
+        std::vector<size_t> ids{};
+        for (const auto& e : scheduler.get_events())
+            ids.push_back(e.worker_id);
+        CHECK(ids == std::vector<size_t>{0, 1, 1, 0, 2});
+    }
+}
+
+TEST_CASE("strand serializes each worker over shared threads")
+{
+    auto obs = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    constexpr size_t strands_count = 1000;
+    constexpr size_t per_strand    = 10;
+
+    struct strand_data
+    {
+        std::atomic_bool    running{};
+        std::atomic_bool    overlapped{};
+        std::vector<size_t> values{};
+    };
+
+    std::vector<strand_data> data(strands_count);
+    std::atomic<size_t>      executed{};
+    std::promise<void>       done{};
+
+    const rpp::schedulers::strand scheduler{2};
+    {
+        std::vector<rpp::schedulers::utils::get_worker_t<rpp::schedulers::strand>> workers{};
+        for (size_t i = 0; i < strands_count; ++i)
+            workers.push_back(scheduler.create_worker());
+
+        for (size_t v = 0; v < per_strand; ++v)
+        {
+            for (size_t i = 0; i < strands_count; ++i)
+            {
+                workers[i].schedule([&, i, v](const auto&) {
+                    auto& d = data[i];
+                    if (d.running.exchange(true))
+                        d.overlapped = true;
+                    d.values.push_back(v);
+                    d.running = false;
+
+                    if (executed.fetch_add(1) + 1 == strands_count * per_strand)
+                        done.set_value();
+                    return rpp::schedulers::optional_delay_from_now{};
+                },
+                                    obs);
+            }
+        }
+    }
+
+    done.get_future().get();
+
+    std::vector<size_t> expected(per_strand);
+    std::iota(expected.begin(), expected.end(), size_t{});
+    for (const auto& d : data)
+    {
+        CHECK(!d.overlapped.load());
+        CHECK(d.values == expected);
+    }
+}
+
+TEST_CASE("io scheduler reuses idle threads and retires them after idle timeout")
+{
+    auto obs = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    // waits till schedulable is destroyed, so its lease of thread is released too
+    const auto get_thread_of = [&](const auto& worker) {
+        std::promise<std::thread::id> id{};
+        std::promise<void>            destroyed{};
+        worker.schedule([&](const auto&, const auto&) {
+            id.set_value(std::this_thread::get_id());
+            return rpp::schedulers::optional_delay_from_now{};
+        },
+                        obs,
+                        std::shared_ptr<void>{nullptr, [&](void*) { destroyed.set_value(); }});
+        destroyed.get_future().wait();
+        return id.get_future().get();
+    };
+
+    SUBCASE("released thread is reused by next worker")
+    {
+        const rpp::schedulers::io scheduler{};
+
+        std::thread::id first{};
+        {
+            const auto worker = scheduler.create_worker();
+            first             = get_thread_of(worker);
+            CHECK(first != std::this_thread::get_id());
+        }
+        CHECK(get_thread_of(scheduler.create_worker()) == first);
+        CHECK(scheduler.get_threads_count() == 1);
+    }
+
+    SUBCASE("alive workers get different threads")
+    {
+        const rpp::schedulers::io scheduler{};
+
+        const auto first  = scheduler.create_worker();
+        const auto second = scheduler.create_worker();
+        CHECK(get_thread_of(first) != get_thread_of(second));
+        CHECK(scheduler.get_threads_count() == 2);
+    }
+
+    SUBCASE("workers share thread when max_threads reached")
+    {
+        const rpp::schedulers::io scheduler{rpp::schedulers::io::options{.max_threads = 1}};
+
+        const auto first  = scheduler.create_worker();
+        const auto second = scheduler.create_worker();
+        CHECK(get_thread_of(first) == get_thread_of(second));
+        CHECK(scheduler.get_threads_count() == 1);
+    }
+
+    SUBCASE("idle threads are retired after idle_timeout")
+    {
+        const rpp::schedulers::io scheduler{rpp::schedulers::io::options{.idle_timeout = std::chrono::milliseconds{10}}};
+
+        {
+            const auto first  = scheduler.create_worker();
+            const auto second = scheduler.create_worker();
+            get_thread_of(first);
+            get_thread_of(second);
+            CHECK(scheduler.get_threads_count() == 2);
+        }
+
+        for (size_t i = 0; i < 500 && scheduler.get_threads_count() != 0; ++i)
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+        CHECK(scheduler.get_threads_count() == 0);
+    }
+
+    SUBCASE("thread is not retired while used")
+    {
+        const rpp::schedulers::io scheduler{rpp::schedulers::io::options{.idle_timeout = std::chrono::milliseconds{1}}};
+
+        {
+            const auto worker = scheduler.create_worker();
+            get_thread_of(worker);
+        }
+        const auto worker = scheduler.create_worker();
+        std::this_thread::sleep_for(std::chrono::milliseconds{20});
+        CHECK(scheduler.get_threads_count() == 1);
+        get_thread_of(worker);
+    }
+
+    SUBCASE("concurrent subscribe_on runs blocking calls on different threads")
+    {
+        const rpp::schedulers::io scheduler{};
+        constexpr size_t          count = 4;
+
+        std::mutex                mutex{};
+        std::condition_variable   cv{};
+        std::set<std::thread::id> threads{};
+        std::atomic<size_t>       completed{};
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            // worker is dropped by subscribe_on right after scheduling, so thread is kept busy by schedulable itself
+            rpp::source::just(1)
+                | rpp::ops::subscribe_on(scheduler)
+                | rpp::ops::subscribe([&](int) {
+                      // blocking call keeps its thread busy till all of them are started, so they can't share one thread
+                      std::unique_lock lock{mutex};
+                      threads.insert(std::this_thread::get_id());
+                      cv.notify_all();
+                      cv.wait_for(lock, std::chrono::seconds{5}, [&] { return threads.size() == count; });
+                  },
+                                      [](const std::exception_ptr&) {},
+                                      [&] { completed.fetch_add(1); });
+
+            // previous blocking calls are already started, so this subscription can't get busy thread
+            std::unique_lock lock{mutex};
+            cv.wait_for(lock, std::chrono::seconds{5}, [&] { return threads.size() == i + 1; });
+        }
+
+        while (completed.load() != count)
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+
+        CHECK(threads.size() == count);
+        CHECK(scheduler.get_threads_count() == count);
+    }
+}
+
+namespace
+{
+    std::atomic<size_t> s_precise_clock_calls{};
+
+    rpp::schedulers::time_point counting_clock()
+    {
+        s_precise_clock_calls.fetch_add(1);
+        return rpp::schedulers::clock_type::now();
+    }
+} // namespace
+
+TEST_CASE("sleep_precision spins on provided clock near deadline")
+{
+    auto obs = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    constexpr auto                         delay = std::chrono::microseconds{300};
+    const rpp::schedulers::sleep_precision precision{.spin_threshold = std::chrono::milliseconds{1}, .clock = &counting_clock};
+    s_precise_clock_calls = 0;
+
+    SUBCASE("current_thread")
+    {
+        const rpp::schedulers::sleep_precision_scope scope{precision};
+
+        std::vector<rpp::schedulers::duration> lateness{};
+        rpp::schedulers::current_thread::create_worker().schedule([&](const auto&) {
+            const auto start = rpp::schedulers::clock_type::now();
+            rpp::schedulers::current_thread::create_worker().schedule(delay, [&, start](const auto&) {
+                lateness.push_back(rpp::schedulers::clock_type::now() - start - delay);
+                if (lateness.size() < 2)
+                    return rpp::schedulers::optional_delay_from_now{delay};
+                return rpp::schedulers::optional_delay_from_now{};
+            },
+                                                                      obs);
+            return rpp::schedulers::optional_delay_from_now{};
+        },
+                                                                  obs);
+
+        REQUIRE(lateness.size() == 2);
+        CHECK(lateness.front() >= rpp::schedulers::duration::zero());
+        CHECK(s_precise_clock_calls.load() > 0);
+    }
+
+    SUBCASE("new_thread")
+    {
+        std::promise<rpp::schedulers::duration> lateness{};
+
+        const auto worker = rpp::schedulers::new_thread::create_worker(rpp::schedulers::new_thread::options{.precision = precision});
+        const auto start  = rpp::schedulers::clock_type::now();
+        worker.schedule(delay, [&](const auto&) {
+            lateness.set_value(rpp::schedulers::clock_type::now() - start - delay);
+            return rpp::schedulers::optional_delay_from_now{};
+        },
+                        obs);
+
+        CHECK(lateness.get_future().get() >= rpp::schedulers::duration::zero());
+        CHECK(s_precise_clock_calls.load() > 0);
+    }
+
+    SUBCASE("default precision doesn't spin")
+    {
+        std::promise<void> done{};
+
+        const auto worker = rpp::schedulers::new_thread::create_worker();
+        worker.schedule(delay, [&](const auto&) {
+            done.set_value();
+            return rpp::schedulers::optional_delay_from_now{};
+        },
+                        obs);
+        done.get_future().get();
+        CHECK(s_precise_clock_calls.load() == 0);
+    }
+}
+
+TEST_CASE("edf_thread executes due schedulables in deadline order and sheds missed ones")
+{
+    auto obs = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    std::mutex                                              mutex{};
+    std::vector<std::string>                                executions{};
+    std::vector<rpp::schedulers::edf_thread::deadline_miss> misses{};
+    rpp::schedulers::edf_thread::options                    opts{.on_deadline_miss = [&](const auto& miss) {
+        std::lock_guard lock{mutex};
+        misses.push_back(miss);
+    }};
+
+    const auto block_thread = [&](const auto& worker, std::future<void> release) {
+        std::promise<void> started{};
+        worker.schedule([&started, release = std::make_shared<std::future<void>>(std::move(release))](const auto&) {
+            started.set_value();
+            release->get();
+            return rpp::schedulers::optional_delay_from_now{};
+        },
+                        obs);
+        started.get_future().get();
+    };
+
+    const auto record_to = [&](const auto& worker, const auto& observer, std::string name, std::promise<void>* done = nullptr) {
+        worker.schedule([&, name, done](const auto&) {
+            {
+                std::lock_guard lock{mutex};
+                executions.push_back(name);
+            }
+            if (done)
+                done->set_value();
+            return rpp::schedulers::optional_delay_from_now{};
+        },
+                        observer);
+    };
+
+    const auto record = [&](const auto& worker, std::string name, std::promise<void>* done = nullptr) {
+        record_to(worker, obs, std::move(name), done);
+    };
+
+    SUBCASE("earliest deadline is executed first")
+    {
+        const rpp::schedulers::edf_thread scheduler{opts};
+
+        std::promise<void> release{};
+        std::promise<void> done{};
+        block_thread(scheduler.create_worker(), release.get_future());
+
+        record(scheduler.create_worker(std::chrono::seconds{10}), "relaxed", &done);
+        record(scheduler.create_worker(std::chrono::seconds{1}), "urgent");
+        record(scheduler.create_worker(std::chrono::seconds{5}), "normal");
+
+        release.set_value();
+        done.get_future().get();
+
+        std::lock_guard lock{mutex};
+        CHECK(executions == std::vector<std::string>{"urgent", "normal", "relaxed"});
+        CHECK(misses.empty());
+        CHECK(scheduler.get_missed_count() == 0);
+    }
+
+    SUBCASE("missed schedulables are dropped and reported with drop policy")
+    {
+        opts.policy = rpp::schedulers::edf_thread::miss_policy::drop;
+        const rpp::schedulers::edf_thread scheduler{opts};
+
+        std::promise<void> release{};
+        std::promise<void> done{};
+        block_thread(scheduler.create_worker(), release.get_future());
+
+        const auto stale      = scheduler.create_worker(std::chrono::milliseconds{1});
+        auto       first_mock = mock_observer_strategy<int>{};
+        auto       other_mock = mock_observer_strategy<int>{};
+        record_to(stale, first_mock.get_observer().as_dynamic(), "stale_1");
+        record_to(stale, other_mock.get_observer().as_dynamic(), "stale_2");
+        record(scheduler.create_worker(), "without_deadline", &done);
+
+        std::this_thread::sleep_for(std::chrono::milliseconds{20});
+        release.set_value();
+        done.get_future().get();
+
+        std::lock_guard lock{mutex};
+        CHECK(executions == std::vector<std::string>{"without_deadline"});
+        REQUIRE(misses.size() == 2);
+        for (const auto& miss : misses)
+        {
+            CHECK(miss.dropped);
+            CHECK(miss.now > miss.deadline);
+            CHECK(miss.deadline - miss.timepoint == std::chrono::milliseconds{1});
+        }
+        CHECK(scheduler.get_missed_count() == 2);
+        // downstream sees end of the stream instead of silent stall
+        CHECK(first_mock.get_on_error_count() == 1);
+        CHECK(other_mock.get_on_error_count() == 1);
+    }
+
+    SUBCASE("missed schedulables are executed by default")
+    {
+        const rpp::schedulers::edf_thread scheduler{opts};
+
+        std::promise<void> release{};
+        std::promise<void> done{};
+        block_thread(scheduler.create_worker(), release.get_future());
+
+        record(scheduler.create_worker(std::chrono::milliseconds{1}), "late", &done);
+
+        std::this_thread::sleep_for(std::chrono::milliseconds{20});
+        release.set_value();
+        done.get_future().get();
+
+        std::lock_guard lock{mutex};
+        CHECK(executions == std::vector<std::string>{"late"});
+        REQUIRE(misses.size() == 1);
+        CHECK(!misses.front().dropped);
+        CHECK(scheduler.get_missed_count() == 1);
+    }
+
+    SUBCASE("recurring schedulable gets new deadline for each execution")
+    {
+        const rpp::schedulers::edf_thread scheduler{opts};
+
+        std::promise<void> done{};
+        size_t             count{};
+        scheduler.create_worker(std::chrono::seconds{1}).schedule([&](const auto&) {
+            if (++count < 5)
+                return rpp::schedulers::optional_delay_from_now{std::chrono::milliseconds{1}};
+            done.set_value();
+            return rpp::schedulers::optional_delay_from_now{};
+        },
+                                                                   obs);
+
+        done.get_future().get();
+        CHECK(count == 5);
+        CHECK(scheduler.get_missed_count() == 0);
+    }
+
+    SUBCASE("nested current_thread schedulings are trampolined")
+    {
+        const rpp::schedulers::edf_thread scheduler{opts};
+
+        std::promise<void> done{};
+        scheduler.create_worker().schedule([&](const auto&) {
+            const auto worker = rpp::schedulers::current_thread::create_worker();
+            worker.schedule([&](const auto&) {
+                executions.push_back("nested");
+                done.set_value();
+                return rpp::schedulers::optional_delay_from_now{};
+            },
+                            obs);
+            executions.push_back("outer");
+            return rpp::schedulers::optional_delay_from_now{};
+        },
+                                           obs);
+
+        done.get_future().get();
+        CHECK(executions == std::vector<std::string>{"outer", "nested"});
+    }
+
+    SUBCASE("thread doesn't wait for disposed timers")
+    {
+        auto d     = rpp::composite_disposable_wrapper::make();
+        auto token = std::make_shared<int>();
+        auto weak  = std::weak_ptr{token};
+        {
+            const rpp::schedulers::edf_thread scheduler{opts};
+            scheduler.create_worker().schedule(std::chrono::hours{1}, [token = std::move(token)](const auto&) {
+                return rpp::schedulers::optional_delay_from_now{};
+            },
+                                               mock_observer_strategy<int>{}.get_observer(d).as_dynamic());
+            d.dispose();
+        }
+
+        for (size_t i = 0; i < 100 && !weak.expired(); ++i)
+            std::this_thread::sleep_for(std::chrono::milliseconds{10});
+        CHECK(weak.expired());
+    }
+}
+
+TEST_CASE("new_thread execution_budget bounds turn of zero-delay re-scheduling")
+{
+    auto obs = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    constexpr size_t iterations = 10;
+
+    // recurring schedulable schedules another one to the same worker during its first execution, returns position of the latter in execution order
+    const auto get_position_of_other = [&](const auto& worker, rpp::schedulers::duration sleep = {}) {
+        std::vector<std::string> executions{};
+        std::promise<void>       done{};
+
+        worker.schedule([&, worker](const auto&) {
+            if (executions.empty())
+            {
+                worker.schedule([&](const auto&) {
+                    executions.push_back("other");
+                    return rpp::schedulers::optional_delay_from_now{};
+                },
+                                obs);
+            }
+            executions.push_back("recurring");
+            std::this_thread::sleep_for(sleep);
+
+            if (std::count(executions.begin(), executions.end(), "recurring") < static_cast<std::ptrdiff_t>(iterations))
+                return rpp::schedulers::optional_delay_from_now{rpp::schedulers::duration::zero()};
+            done.set_value();
+            return rpp::schedulers::optional_delay_from_now{};
+        },
+                        obs);
+
+        done.get_future().get();
+        REQUIRE(executions.size() == iterations + 1);
+        return static_cast<size_t>(std::find(executions.begin(), executions.end(), "other") - executions.begin());
+    };
+
+    SUBCASE("without budget schedulable is re-queued after each execution in case of pending ones")
+    {
+        CHECK(get_position_of_other(rpp::schedulers::new_thread::create_worker()) == 1);
+    }
+
+    SUBCASE("iterations budget keeps schedulable running in place for the whole turn")
+    {
+        CHECK(get_position_of_other(rpp::schedulers::new_thread::create_worker(rpp::schedulers::new_thread::options{.budget = {.iterations = 3}})) == 3);
+    }
+
+    SUBCASE("time budget keeps schedulable running in place till time is spent")
+    {
+        const auto position = get_position_of_other(rpp::schedulers::new_thread::create_worker(rpp::schedulers::new_thread::options{.budget = {.time = std::chrono::milliseconds{5}}}), std::chrono::milliseconds{1});
+        CHECK(position >= 1);
+        CHECK(position <= 5);
+    }
+}
@@ -18,9 +18,13 @@
 #include "rpp/schedulers/fwd.hpp"
 
 #include <QApplication>
+#include <algorithm>
 #include <future>
+#include <numeric>
 #include <optional>
+#include <string>
 #include <thread>
+#include <vector>
 
 TEST_CASE("main_thread_scheduler schedules actions to main thread")
 {
@@ -117,3 +121,134 @@ TEST_CASE("no application")
 
     CHECK(mock.get_on_error_count() == 1);
 }
+
+TEST_CASE("coalescing_main_thread_scheduler schedules actions to main thread")
+{
+    auto d        = rpp::composite_disposable_wrapper::make();
+    auto observer = mock_observer_strategy<int>{}.get_observer(d).as_dynamic();
+
+    int              argc{};
+    QCoreApplication application{argc, nullptr};
+    QTimer::singleShot(50, &application, [&] { application.exit(); });
+
+    const rppqt::schedulers::coalescing_main_thread_scheduler scheduler{};
+
+    SUBCASE("submitting actions to main scheduler from another thread")
+    {
+        std::vector<size_t>          executions{};
+        std::vector<std::thread::id> threads{};
+        std::thread{[&] {
+            const auto worker = scheduler.create_worker();
+            for (size_t i = 0; i < 1000; ++i)
+            {
+                worker.schedule([&, i](const auto&) -> rpp::schedulers::optional_delay_from_now {
+                    executions.push_back(i);
+                    threads.push_back(std::this_thread::get_id());
+                    return {};
+                },
+                                observer);
+            }
+        }}.join();
+
+        application.exec();
+
+        std::vector<size_t> expected(1000);
+        std::iota(expected.begin(), expected.end(), size_t{});
+        CHECK(executions == expected);
+        CHECK(std::all_of(threads.begin(), threads.end(), [](const auto& id) { return id == std::this_thread::get_id(); }));
+    }
+
+    SUBCASE("nothing happens for disposed handler")
+    {
+        bool executed{};
+        scheduler.create_worker().schedule([&](const auto&) -> rpp::schedulers::optional_delay_from_now {
+            executed = true;
+            return {};
+        },
+                                           observer);
+        d.dispose();
+
+        application.exec();
+        CHECK(!executed);
+    }
+
+    SUBCASE("recursive and delayed scheduling to main thread")
+    {
+        std::string execution{};
+        scheduler.create_worker().schedule([&](const auto&) {
+            scheduler.create_worker().schedule(std::chrono::milliseconds{5}, [&](const auto&) -> rpp::schedulers::optional_delay_from_now {
+                execution += "delayed ";
+                return {};
+            },
+                                               observer);
+            scheduler.create_worker().schedule([&](const auto&) -> rpp::schedulers::optional_delay_from_now {
+                execution += "inner ";
+                return {};
+            },
+                                               observer);
+
+            const bool first_run = execution.empty();
+            execution += "outer ";
+            return first_run ? rpp::schedulers::optional_delay_from_now{std::chrono::milliseconds{1}} : std::nullopt;
+        },
+                                           observer);
+
+        application.exec();
+        CHECK(execution == "outer inner outer inner delayed delayed ");
+    }
+
+    SUBCASE("earlier wake-up supersedes pending delayed one")
+    {
+        std::string execution{};
+        const auto  worker = scheduler.create_worker();
+        worker.schedule(std::chrono::milliseconds{20}, [&](const auto&) -> rpp::schedulers::optional_delay_from_now {
+            execution += "delayed ";
+            return {};
+        },
+                        observer);
+        worker.schedule([&](const auto&) -> rpp::schedulers::optional_delay_from_now {
+            execution += "immediate ";
+            return {};
+        },
+                        observer);
+
+        application.exec();
+        CHECK(execution == "immediate delayed ");
+    }
+}
+
+TEST_CASE("coalescing_main_thread_scheduler progresses with non-positive turn budget")
+{
+    auto observer = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    int              argc{};
+    QCoreApplication application{argc, nullptr};
+    QTimer::singleShot(50, &application, [&] { application.exit(); });
+
+    const rppqt::schedulers::coalescing_main_thread_scheduler scheduler{rppqt::schedulers::coalescing_main_thread_scheduler::options{.turn_budget = std::chrono::milliseconds{-1}}};
+
+    size_t     executed{};
+    const auto worker = scheduler.create_worker();
+    for (size_t i = 0; i < 100; ++i)
+    {
+        worker.schedule([&](const auto&) -> rpp::schedulers::optional_delay_from_now {
+            ++executed;
+            return {};
+        },
+                        observer);
+    }
+
+    application.exec();
+    CHECK(executed == 100);
+}
+
+TEST_CASE("coalescing_main_thread_scheduler without application")
+{
+    mock_observer_strategy<int> mock{};
+    rppqt::schedulers::coalescing_main_thread_scheduler{}.create_worker().schedule([&](const auto&) -> rpp::schedulers::optional_delay_from_now {
+        return {};
+    },
+                                                                                   mock);
+
+    CHECK(mock.get_on_error_count() == 1);
+}